@@ -0,0 +1,80 @@
+#pragma once
+// ============================================================
+// Branch Predictor
+// ------------------------------------------------------------
+// Bit-level copy of Branch_Predictor.sv: direct-mapped BTB with
+// a full tag, 2-bit counters indexed by pc ^ ghr, JALs always
+// taken on a BTB hit, JALR never predicted. Counter encoding
+// and the GHR update ({ghr[W-1:1], taken}) follow the RTL as is
+// so the model mispredicts where the RTL does.
+// ============================================================
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+class BranchPredictor {
+public:
+    enum : uint8_t { sTaken = 2, wTaken = 0, wNtaken = 1, sNtaken = 3 };
+    enum BType : uint8_t { B_OTHER = 0, B_JAL = 1, B_BRANCH = 2 };
+
+    BranchPredictor(unsigned btbEntries, unsigned phtEntries)
+        : btbBits_(log2(btbEntries)), ghrBits_(log2(phtEntries)),
+          btb_(size_t(1) << btbBits_), pht_(size_t(1) << ghrBits_, wTaken) {}
+
+    void lookup(uint32_t pc, bool &taken, uint32_t &target) const {
+        const Entry &e = btb_[btbIdx(pc)];
+        bool hit = e.valid && e.tag == tag(pc);
+        taken  = hit && (e.isJal || !(pht_[phtIdx(pc)] & 1));
+        target = e.target;
+    }
+
+    void update(uint32_t pc, BType type, bool taken, uint32_t target) {
+        Entry &e   = btb_[btbIdx(pc)];
+        bool   hit = e.valid && e.tag == tag(pc);
+        if (type == B_BRANCH) {
+            uint8_t &cnt = pht_[phtIdx(pc)];
+            if (hit) {
+                cnt = nextCount(cnt, taken);
+            } else {
+                cnt = taken ? wTaken : wNtaken;
+                e   = Entry{true, tag(pc), target, false};
+            }
+            uint32_t mask = (1u << ghrBits_) - 1;
+            ghr_ = ((ghr_ & ~1u) | uint32_t(taken)) & mask;
+        } else if (type == B_JAL) {
+            if (!hit) e = Entry{true, tag(pc), target, true};
+        }
+    }
+
+private:
+    struct Entry {
+        bool     valid  = false;
+        uint32_t tag    = 0;
+        uint32_t target = 0;
+        bool     isJal  = false;
+    };
+
+    static unsigned log2(unsigned n) {
+        unsigned b = 0;
+        while ((1u << b) < n) b++;
+        return b ? b : 1;
+    }
+
+    uint32_t btbIdx(uint32_t pc) const { return (pc >> 2) & ((1u << btbBits_) - 1); }
+    uint32_t tag(uint32_t pc) const    { return pc >> (btbBits_ + 2); }
+    uint32_t phtIdx(uint32_t pc) const { return ((pc >> 2) ^ ghr_) & ((1u << ghrBits_) - 1); }
+
+    static uint8_t nextCount(uint8_t c, bool taken) {
+        switch (c) {
+            case wTaken:  return taken ? sTaken  : wNtaken;
+            case sTaken:  return taken ? sTaken  : wTaken;
+            case wNtaken: return taken ? wTaken  : sNtaken;
+            default:      return taken ? wNtaken : sNtaken;
+        }
+    }
+
+    unsigned             btbBits_, ghrBits_;
+    uint32_t             ghr_ = 0;
+    std::vector<Entry>   btb_;
+    std::vector<uint8_t> pht_;
+};
@@ -0,0 +1,66 @@
+#include "config.h"
+
+#include <cstdlib>
+
+const std::vector<Knob> &knobs() {
+    static const std::vector<Knob> table = {
+        {"ifq_depth",         &Config::ifq_depth,         4, "fetch queue entries (holds a 4-beat burst)"},
+        {"btb_entries",       &Config::btb_entries,       1, "BTB entries (power of 2)"},
+        {"pht_entries",       &Config::pht_entries,       1, "PHT entries / GHR width (power of 2)"},
+        {"fuse",              &Config::fuse,              0, "macro-op fusion (0/1)"},
+        {"redirect_lat",      &Config::redirect_lat,      0, "extra redirect cycles"},
+        {"mul_lat",           &Config::mul_lat,           1, "EX cycles for M ops"},
+        {"fpu_lat",           &Config::fpu_lat,           1, "EX cycles for F ops"},
+        {"sb_entries",        &Config::sb_entries,        1, "store buffer entries"},
+        {"sb_line_words",     &Config::sb_line_words,     1, "store buffer words per entry"},
+        {"sb_drain_age",      &Config::sb_drain_age,      1, "cycles a lone entry waits"},
+        {"rom_lat",           &Config::rom_lat,           1, "ROM address to first beat"},
+        {"sram_lat",          &Config::sram_lat,          1, "IM/DM address to first beat"},
+        {"dev_lat",           &Config::dev_lat,           1, "device address to first beat"},
+        {"dram_trp",          &Config::dram_trp,          1, "DRAM precharge cycles"},
+        {"dram_trcd",         &Config::dram_trcd,         1, "DRAM row activation cycles"},
+        {"dram_cl",           &Config::dram_cl,           1, "DRAM CAS latency"},
+        {"dram_cdc",          &Config::dram_cdc,          0, "DRAM clock-crossing cycles each way"},
+        {"dram_streams",      &Config::dram_streams,      0, "DRAM read-ahead streams"},
+        {"dram_stream_depth", &Config::dram_stream_depth, 1, "DRAM read-ahead words per stream"},
+        {"dma_burst",         &Config::dma_burst,         1, "DMA max burst words"},
+        {"wdt_ratio",         &Config::wdt_ratio,         1, "WDT clock divider"},
+        {"max_cycles",        &Config::max_cycles,        1, "cycle limit"},
+    };
+    return table;
+}
+
+bool Config::set(const std::string &assignment, std::string &error) {
+    size_t eq = assignment.find('=');
+    if (eq == std::string::npos) {
+        error = "expected name=value, got '" + assignment + "'";
+        return false;
+    }
+    std::string name = assignment.substr(0, eq), value = assignment.substr(eq + 1);
+    for (const Knob &k : knobs()) {
+        if (name != k.name) continue;
+        char   *end = nullptr;
+        int64_t v   = std::strtoll(value.c_str(), &end, 0);
+        if (value.empty() || *end != '\0') {
+            error = "bad value '" + value + "' for " + name;
+            return false;
+        }
+        if (v < k.min) {
+            error = name + " must be >= " + std::to_string(k.min);
+            return false;
+        }
+        this->*k.field = v;
+        return true;
+    }
+    error = "unknown knob '" + name + "' (see --list)";
+    return false;
+}
+
+std::string Config::describe() const {
+    std::string s;
+    for (const Knob &k : knobs()) {
+        if (!s.empty()) s += ' ';
+        s += std::string(k.name) + "=" + std::to_string(this->*k.field);
+    }
+    return s;
+}
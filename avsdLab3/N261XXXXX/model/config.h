@@ -0,0 +1,60 @@
+#pragma once
+// ============================================================
+// Model Configuration
+// ------------------------------------------------------------
+// Every size and latency the timing model uses. Defaults match
+// the RTL as built by `make rtl_all` (non-DEEP core, default
+// wrapper parameters, synchronous DRAM path).
+// ============================================================
+#include <cstdint>
+#include <string>
+#include <vector>
+
+struct Config {
+    // Front end
+    int64_t ifq_depth      = 8;     // IFID DEPTH
+    int64_t btb_entries    = 16;    // Branch_Predictor BTB_ENTRIES
+    int64_t pht_entries    = 16;    // Branch_Predictor PHT_ENTRIES
+    int64_t fuse           = 1;     // macro-op fusion in ID
+    int64_t redirect_lat   = 0;     // extra cycles before a redirect reaches fetch
+
+    // Execute
+    int64_t mul_lat        = 1;     // EX cycles for M ops
+    int64_t fpu_lat        = 1;     // EX cycles for F ops
+
+    // Store buffer
+    int64_t sb_entries     = 4;
+    int64_t sb_line_words  = 4;
+    int64_t sb_drain_age   = 16;
+
+    // Slaves
+    int64_t rom_lat        = 1;     // AR/AW to first beat
+    int64_t sram_lat       = 1;
+    int64_t dev_lat        = 1;
+    int64_t dram_trp       = 5;     // PreCharge cycles
+    int64_t dram_trcd      = 5;     // RowActivation cycles
+    int64_t dram_cl        = 5;     // CAS to data
+    int64_t dram_cdc       = 0;     // extra cycles each way (DRAM_ASYNC bridge)
+    int64_t dram_streams   = 3;     // DRAM_wrapper SB_STREAMS, top sets NUM_M (0: off)
+    int64_t dram_stream_depth = 4;  // DRAM_wrapper SB_DEPTH
+
+    // Devices
+    int64_t dma_burst      = 16;    // max DMA burst (words)
+    int64_t wdt_ratio      = 10;    // clk2 period / clk period
+
+    // Run
+    int64_t max_cycles     = 6000000;
+
+    // "name=value"; false with a message on a bad name or value
+    bool set(const std::string &assignment, std::string &error);
+    std::string describe() const;
+};
+
+struct Knob {
+    const char       *name;
+    int64_t Config::*field;
+    int64_t           min;
+    const char       *help;
+};
+
+const std::vector<Knob> &knobs();
@@ -0,0 +1,524 @@
+#include "core.h"
+
+#include <cmath>
+#include <cstring>
+#include <limits>
+
+namespace {
+
+// ------------------------------------------------------------
+// Opcodes (inst[6:0])
+// ------------------------------------------------------------
+constexpr uint8_t OPC_LOAD   = 0x03;
+constexpr uint8_t OPC_FLW    = 0x07;
+constexpr uint8_t OPC_FENCE  = 0x0F;
+constexpr uint8_t OPC_IMM    = 0x13;
+constexpr uint8_t OPC_AUIPC  = 0x17;
+constexpr uint8_t OPC_STORE  = 0x23;
+constexpr uint8_t OPC_FSW    = 0x27;
+constexpr uint8_t OPC_OP     = 0x33;
+constexpr uint8_t OPC_LUI    = 0x37;
+constexpr uint8_t OPC_FMADD  = 0x43;
+constexpr uint8_t OPC_FMSUB  = 0x47;
+constexpr uint8_t OPC_FNMSUB = 0x4B;
+constexpr uint8_t OPC_FNMADD = 0x4F;
+constexpr uint8_t OPC_FP     = 0x53;
+constexpr uint8_t OPC_BRANCH = 0x63;
+constexpr uint8_t OPC_JALR   = 0x67;
+constexpr uint8_t OPC_JAL    = 0x6F;
+constexpr uint8_t OPC_SYSTEM = 0x73;
+
+// ------------------------------------------------------------
+// CSR indices and fields (CPU_define.svh)
+// ------------------------------------------------------------
+constexpr uint32_t CSR_MSTATUS  = 0x300;
+constexpr uint32_t CSR_MIE      = 0x304;
+constexpr uint32_t CSR_MTVEC    = 0x305;
+constexpr uint32_t CSR_MEPC     = 0x341;
+constexpr uint32_t CSR_MCAUSE   = 0x342;
+constexpr uint32_t CSR_MIP      = 0x344;
+constexpr uint32_t CSR_CYCLE    = 0xC00;
+constexpr uint32_t CSR_INSTRET  = 0xC02;
+constexpr uint32_t CSR_CYCLEH   = 0xC80;
+constexpr uint32_t CSR_INSTRETH = 0xC82;
+constexpr uint32_t CSR_MHARTID  = 0xF14;
+
+constexpr uint32_t MTVEC_BASE = 0x0001'0000u;
+constexpr uint32_t MSTATUS_MIE  = 1u << 3;
+constexpr uint32_t MSTATUS_MPIE = 1u << 7;
+constexpr uint32_t MSTATUS_MPP  = 3u << 11;
+constexpr uint32_t MIP_MTIP = 1u << 7;
+constexpr uint32_t MIP_MEIP = 1u << 11;
+constexpr unsigned CAUSE_MTI = 7;
+constexpr unsigned CAUSE_MEI = 11;
+
+constexpr uint32_t CANONICAL_NAN = 0x7FC0'0000u;
+
+inline int32_t sext(uint32_t v, unsigned bits) {
+    return int32_t(v << (32 - bits)) >> (32 - bits);
+}
+
+inline int32_t immI(uint32_t i) { return int32_t(i) >> 20; }
+inline int32_t immS(uint32_t i) { return sext(((i >> 25) << 5) | ((i >> 7) & 0x1F), 12); }
+inline int32_t immB(uint32_t i) {
+    return sext(((i >> 31) << 12) | (((i >> 7) & 1) << 11) | (((i >> 25) & 0x3F) << 5) |
+                (((i >> 8) & 0xF) << 1), 13);
+}
+inline int32_t immJ(uint32_t i) {
+    return sext(((i >> 31) << 20) | (((i >> 12) & 0xFF) << 12) | (((i >> 20) & 1) << 11) |
+                (((i >> 21) & 0x3FF) << 1), 21);
+}
+
+inline float    asFloat(uint32_t v) { float f; std::memcpy(&f, &v, 4); return f; }
+inline uint32_t asBits(float f)     { uint32_t v; std::memcpy(&v, &f, 4); return v; }
+inline bool     isNaN(uint32_t v)   { return (v & 0x7F80'0000u) == 0x7F80'0000u && (v & 0x007F'FFFFu); }
+inline uint32_t canon(float f)      { return std::isnan(f) ? CANONICAL_NAN : asBits(f); }
+
+// Round to integral in the requested RISC-V mode (7: dynamic = RNE here)
+double roundMode(double v, unsigned rm) {
+    switch (rm) {
+        case 1:  return std::trunc(v);
+        case 2:  return std::floor(v);
+        case 3:  return std::ceil(v);
+        case 4:  return std::round(v);
+        default: return std::nearbyint(v);
+    }
+}
+
+uint32_t fclass(uint32_t v) {
+    bool     sign = v >> 31;
+    uint32_t exp  = (v >> 23) & 0xFF, man = v & 0x7F'FFFF;
+    if (exp == 0xFF) {
+        if (man == 0) return sign ? 1u << 0 : 1u << 7;
+        return (man & 0x40'0000) ? 1u << 9 : 1u << 8;
+    }
+    if (exp == 0) {
+        if (man == 0) return sign ? 1u << 3 : 1u << 4;
+        return sign ? 1u << 2 : 1u << 5;
+    }
+    return sign ? 1u << 1 : 1u << 6;
+}
+
+}  // namespace
+
+// ============================================================
+// Decode
+// ============================================================
+Decoded decode(uint32_t inst) {
+    Decoded d;
+    d.inst   = inst;
+    d.opcode = inst & 0x7F;
+    d.funct3 = (inst >> 12) & 7;
+    d.rd     = (inst >> 7) & 0x1F;
+    d.rs1    = (inst >> 15) & 0x1F;
+    d.rs2    = (inst >> 20) & 0x1F;
+    d.rs3    = inst >> 27;
+    uint32_t funct7 = inst >> 25;
+
+    switch (d.opcode) {
+        case OPC_LUI:
+        case OPC_AUIPC:
+            d.kind  = Kind::Alu;
+            d.rdInt = true;
+            break;
+        case OPC_IMM:
+            d.kind   = Kind::Alu;
+            d.rdInt  = true;
+            d.rs1Int = true;
+            break;
+        case OPC_OP:
+            d.kind   = (funct7 == 1) ? (d.funct3 < 4 ? Kind::Mul : Kind::Div) : Kind::Alu;
+            d.rdInt  = true;
+            d.rs1Int = d.rs2Int = true;
+            break;
+        case OPC_JAL:
+            d.kind  = Kind::Jal;
+            d.rdInt = true;
+            break;
+        case OPC_JALR:
+            d.kind   = Kind::Jalr;
+            d.rdInt  = true;
+            d.rs1Int = true;
+            break;
+        case OPC_BRANCH:
+            d.kind   = Kind::Branch;
+            d.rs1Int = d.rs2Int = true;
+            break;
+        case OPC_LOAD:
+            d.kind    = Kind::Load;
+            d.rdInt   = true;
+            d.rs1Int  = true;
+            d.memSize = uint8_t(1u << (d.funct3 & 3));
+            break;
+        case OPC_FLW:
+            d.kind    = Kind::Load;
+            d.rdFp    = true;
+            d.rs1Int  = true;
+            d.memSize = 4;
+            break;
+        case OPC_STORE:
+            d.kind    = Kind::Store;
+            d.rs1Int  = d.rs2Int = true;
+            d.memSize = uint8_t(1u << (d.funct3 & 3));
+            break;
+        case OPC_FSW:
+            d.kind    = Kind::Store;
+            d.rs1Int  = true;
+            d.rs2Fp   = true;
+            d.memSize = 4;
+            break;
+        case OPC_FMADD:
+        case OPC_FMSUB:
+        case OPC_FNMSUB:
+        case OPC_FNMADD:
+            d.kind  = Kind::Fpu;
+            d.rdFp  = true;
+            d.rs1Fp = d.rs2Fp = d.rs3Fp = true;
+            break;
+        case OPC_FP: {
+            d.kind = Kind::Fpu;
+            switch (funct7) {
+                case 0x60:                      // fcvt.w[u].s
+                    d.rdInt = true; d.rs1Fp = true; break;
+                case 0x70:                      // fmv.x.w / fclass
+                    d.rdInt = true; d.rs1Fp = true; break;
+                case 0x50:                      // feq / flt / fle
+                    d.rdInt = true; d.rs1Fp = d.rs2Fp = true; break;
+                case 0x68:                      // fcvt.s.w[u]
+                case 0x78:                      // fmv.w.x
+                    d.rdFp = true; d.rs1Int = true; break;
+                case 0x2C:                      // fsqrt
+                    d.rdFp = true; d.rs1Fp = true; break;
+                default:
+                    d.rdFp = true; d.rs1Fp = d.rs2Fp = true; break;
+            }
+            break;
+        }
+        case OPC_FENCE:
+            d.kind = Kind::Fence;
+            break;
+        case OPC_SYSTEM:
+            if (d.funct3 != 0) {
+                d.kind   = Kind::Csr;
+                d.rdInt  = true;
+                d.rs1Int = !(d.funct3 & 4);
+            } else if (inst == 0x1050'0073u) {
+                d.kind = Kind::Wfi;
+            } else if (inst == 0x3020'0073u) {
+                d.kind = Kind::Mret;
+            }
+            break;
+        default:
+            break;
+    }
+    if (d.rdInt && d.rd == 0) d.rdInt = false;
+    return d;
+}
+
+// ============================================================
+// Reset
+// ============================================================
+void Core::reset(uint32_t resetPc) {
+    pc = resetPc;
+    std::memset(x, 0, sizeof(x));
+    std::memset(f, 0, sizeof(f));
+    mstatus = mie = mepc = mcause = mip = 0;
+    mtvec   = MTVEC_BASE;
+    cycle = instret = 0;
+}
+
+// ============================================================
+// CSR File
+// ============================================================
+uint32_t Core::csrRead(uint32_t idx) const {
+    switch (idx) {
+        case CSR_INSTRETH: return uint32_t(instret >> 32);
+        case CSR_INSTRET:  return uint32_t(instret);
+        case CSR_CYCLEH:   return uint32_t(cycle >> 32);
+        case CSR_CYCLE:    return uint32_t(cycle);
+        case CSR_MSTATUS:  return mstatus;
+        case CSR_MIE:      return mie;
+        case CSR_MTVEC:    return mtvec;
+        case CSR_MEPC:     return mepc;
+        case CSR_MCAUSE:   return mcause;
+        case CSR_MIP:      return mip;
+        case CSR_MHARTID:  return hartId_;
+        default:           return 0;
+    }
+}
+
+void Core::csrWrite(uint32_t idx, uint32_t v) {
+    switch (idx) {
+        case CSR_MSTATUS: mstatus = v & (MSTATUS_MPP | MSTATUS_MPIE | MSTATUS_MIE); break;
+        case CSR_MIE:     mie     = v & (MIP_MEIP | MIP_MTIP); break;
+        case CSR_MTVEC:   mtvec   = (mtvec & ~3u) | (v & 1); break;
+        case CSR_MEPC:    mepc    = v & ~3u; break;
+        case CSR_MCAUSE:  mcause  = v & 0x8000'000Fu; break;
+        case CSR_MIP:     mip     = 0; break;
+        default:          break;
+    }
+}
+
+// ============================================================
+// Interrupts
+// ============================================================
+bool Core::interruptPending() const {
+    return (mstatus & MSTATUS_MIE) && (mip & mie & (MIP_MEIP | MIP_MTIP));
+}
+
+unsigned Core::pendingCause() const {
+    return (mip & mie & MIP_MEIP) ? CAUSE_MEI : CAUSE_MTI;
+}
+
+uint32_t Core::vector(unsigned cause) const {
+    uint32_t base = mtvec & ~3u;
+    return (mtvec & 1) ? base + 4 * cause : base;
+}
+
+void Core::takeInterrupt(uint32_t mepcValue) {
+    unsigned cause = pendingCause();
+    mstatus = MSTATUS_MPP | ((mstatus & MSTATUS_MIE) ? MSTATUS_MPIE : 0);
+    mip     = 0;
+    mepc    = mepcValue;
+    mcause  = 0x8000'0000u | cause;
+    pc      = vector(cause);
+}
+
+// ============================================================
+// Floating Point
+// ------------------------------------------------------------
+// Host single precision, round to nearest even for arithmetic;
+// conversions honour the static rounding mode. NaN results are
+// canonical and fflags are not tracked.
+// ============================================================
+uint32_t Core::fpu(const Decoded &d, bool &writesInt) {
+    uint32_t a = f[d.rs1], b = f[d.rs2], c = f[d.rs3];
+    float    fa = asFloat(a), fb = asFloat(b), fc = asFloat(c);
+    uint32_t funct7 = d.inst >> 25;
+    writesInt = false;
+
+    switch (d.opcode) {
+        case OPC_FMADD:  return canon(std::fma(fa, fb, fc));
+        case OPC_FMSUB:  return canon(std::fma(fa, fb, -fc));
+        case OPC_FNMSUB: return canon(std::fma(-fa, fb, fc));
+        case OPC_FNMADD: return canon(std::fma(-fa, fb, -fc));
+        default:         break;
+    }
+
+    switch (funct7) {
+        case 0x00: return canon(fa + fb);
+        case 0x04: return canon(fa - fb);
+        case 0x08: return canon(fa * fb);
+        case 0x0C: return canon(fa / fb);
+        case 0x2C: return canon(std::sqrt(fa));
+        case 0x10: {
+            uint32_t sign = d.funct3 == 0 ? (b & 0x8000'0000u)
+                          : d.funct3 == 1 ? (~b & 0x8000'0000u)
+                                          : ((a ^ b) & 0x8000'0000u);
+            return (a & 0x7FFF'FFFFu) | sign;
+        }
+        case 0x14: {
+            bool an = isNaN(a), bn = isNaN(b);
+            if (an && bn) return CANONICAL_NAN;
+            if (an) return b;
+            if (bn) return a;
+            if (fa == fb) {
+                // -0 < +0
+                bool aNeg = a >> 31;
+                return (d.funct3 == 0) == aNeg ? a : b;
+            }
+            return (d.funct3 == 0) == (fa < fb) ? a : b;
+        }
+        case 0x60: {
+            writesInt = true;
+            unsigned rm = (d.funct3 == 7) ? 0 : d.funct3;
+            double   r  = roundMode(double(fa), rm);
+            if (d.rs2 == 0) {
+                if (isNaN(a) || r >= 2147483648.0) return 0x7FFF'FFFFu;
+                if (r < -2147483648.0) return 0x8000'0000u;
+                return uint32_t(int32_t(r));
+            }
+            if (isNaN(a) || r >= 4294967296.0) return 0xFFFF'FFFFu;
+            if (r < 0.0) return 0;
+            return uint32_t(r);
+        }
+        case 0x70:
+            writesInt = true;
+            return d.funct3 == 0 ? a : fclass(a);
+        case 0x50:
+            writesInt = true;
+            if (isNaN(a) || isNaN(b)) return 0;
+            switch (d.funct3) {
+                case 2:  return fa == fb;
+                case 1:  return fa < fb;
+                default: return fa <= fb;
+            }
+        case 0x68: {
+            uint32_t v = x[d.rs1];
+            return asBits(d.rs2 == 0 ? float(int32_t(v)) : float(v));
+        }
+        case 0x78:
+            return x[d.rs1];
+        default:
+            return 0;
+    }
+}
+
+// ============================================================
+// Execute
+// ============================================================
+void Core::execute(const Decoded &d, DataPort &port, ExecResult &r) {
+    uint32_t inst = d.inst;
+    uint32_t a = x[d.rs1], b = x[d.rs2];
+    uint32_t next = pc + 4;
+    uint32_t rdv  = 0;
+
+    r = ExecResult();
+    r.pc = pc;
+
+    switch (d.kind) {
+        case Kind::Alu: {
+            if (d.opcode == OPC_LUI)   { rdv = inst & 0xFFFF'F000u; break; }
+            if (d.opcode == OPC_AUIPC) { rdv = pc + (inst & 0xFFFF'F000u); break; }
+            bool     imm = d.opcode == OPC_IMM;
+            uint32_t s2  = imm ? uint32_t(immI(inst)) : b;
+            bool     alt = (inst >> 30) & 1;
+            switch (d.funct3) {
+                case 0: rdv = (!imm && alt) ? a - s2 : a + s2; break;
+                case 1: rdv = a << (s2 & 31); break;
+                case 2: rdv = int32_t(a) < int32_t(s2); break;
+                case 3: rdv = a < s2; break;
+                case 4: rdv = a ^ s2; break;
+                case 5: rdv = alt ? uint32_t(int32_t(a) >> (s2 & 31)) : a >> (s2 & 31); break;
+                case 6: rdv = a | s2; break;
+                case 7: rdv = a & s2; break;
+            }
+            break;
+        }
+        case Kind::Mul: {
+            int64_t  sa = int32_t(a), sb = int32_t(b);
+            uint64_t ua = a, ub = b;
+            switch (d.funct3) {
+                case 0: rdv = uint32_t(sa * sb); break;
+                case 1: rdv = uint32_t(uint64_t(sa * sb) >> 32); break;
+                case 2: rdv = uint32_t(uint64_t(sa * int64_t(ub)) >> 32); break;
+                case 3: rdv = uint32_t((ua * ub) >> 32); break;
+            }
+            break;
+        }
+        case Kind::Div: {
+            int32_t sa = int32_t(a), sb = int32_t(b);
+            switch (d.funct3) {
+                case 4:
+                    rdv = b == 0 ? 0xFFFF'FFFFu
+                        : (sa == std::numeric_limits<int32_t>::min() && sb == -1) ? a
+                        : uint32_t(sa / sb);
+                    break;
+                case 5: rdv = b == 0 ? 0xFFFF'FFFFu : a / b; break;
+                case 6:
+                    rdv = b == 0 ? a
+                        : (sa == std::numeric_limits<int32_t>::min() && sb == -1) ? 0
+                        : uint32_t(sa % sb);
+                    break;
+                case 7: rdv = b == 0 ? a : a % b; break;
+            }
+            break;
+        }
+        case Kind::Jal:
+            rdv      = pc + 4;
+            r.taken  = true;
+            r.target = (pc + immJ(inst)) & ~3u;
+            next     = r.target;
+            break;
+        case Kind::Jalr:
+            rdv      = pc + 4;
+            r.taken  = true;
+            r.target = (a + immI(inst)) & ~3u;
+            next     = r.target;
+            break;
+        case Kind::Branch: {
+            bool t = false;
+            switch (d.funct3) {
+                case 0: t = a == b; break;
+                case 1: t = a != b; break;
+                case 4: t = int32_t(a) <  int32_t(b); break;
+                case 5: t = int32_t(a) >= int32_t(b); break;
+                case 6: t = a <  b; break;
+                case 7: t = a >= b; break;
+            }
+            r.taken  = t;
+            r.target = (pc + immB(inst)) & ~3u;
+            if (t) next = r.target;
+            break;
+        }
+        case Kind::Load: {
+            r.memAddr = a + immI(inst);
+            uint32_t v = port.load(r.memAddr, d.memSize);
+            if (d.rdFp) {
+                f[d.rd] = v;
+            } else {
+                switch (d.funct3) {
+                    case 0: rdv = uint32_t(sext(v, 8)); break;
+                    case 1: rdv = uint32_t(sext(v, 16)); break;
+                    default: rdv = v; break;
+                }
+            }
+            break;
+        }
+        case Kind::Store:
+            r.memAddr  = a + immS(inst);
+            r.memWrite = true;
+            port.store(r.memAddr, d.rs2Fp ? f[d.rs2] : b, d.memSize);
+            break;
+        case Kind::Fpu: {
+            bool     toInt;
+            uint32_t v = fpu(d, toInt);
+            if (toInt) rdv = v;
+            else       f[d.rd] = v;
+            break;
+        }
+        case Kind::Csr: {
+            uint32_t idx = inst >> 20;
+            uint32_t src = (d.funct3 & 4) ? d.rs1 : a;
+            uint32_t old = csrRead(idx);
+            uint32_t wv  = old;
+            switch (d.funct3 & 3) {
+                case 1: wv = src; break;
+                case 2: wv = old | src; break;
+                case 3: wv = old & ~src; break;
+            }
+            rdv = old;
+            csrWrite(idx, wv);
+            break;
+        }
+        case Kind::Mret:
+            // The tail-chain case is taken by the caller before
+            // execute, like Controller_EX checks it first
+            mstatus  = MSTATUS_MPP | MSTATUS_MPIE | ((mstatus & MSTATUS_MPIE) ? MSTATUS_MIE : 0);
+            mip      = 0;
+            r.taken  = true;
+            r.target = mepc;
+            next     = mepc;
+            break;
+        case Kind::Fence:
+        case Kind::Wfi:
+        case Kind::Nop:
+            break;
+    }
+
+    if (d.rdInt) x[d.rd] = rdv;
+    x[0]     = 0;
+    r.nextPc = next;
+    pc       = next;
+}
+
+bool Core::mretChains() const {
+    return (mstatus & MSTATUS_MPIE) && (mip & mie & (MIP_MEIP | MIP_MTIP));
+}
+
+void Core::chainInterrupt() {
+    unsigned cause = pendingCause();
+    mip    = 0;
+    mcause = 0x8000'0000u | cause;
+    pc     = vector(cause);
+}
@@ -0,0 +1,101 @@
+#pragma once
+// ============================================================
+// Functional RV32IMF Hart
+// ------------------------------------------------------------
+// Executes one instruction at a time in program order; the
+// timing model (soc.cpp) decides when. Machine mode only, with
+// the CSR subset and interrupt behaviour of CSR_File and
+// Controller_EX: mtvec BASE fixed at 0x0001_0000, external
+// (DMA) before timer (WDT), mret tail-chains into a pending
+// handler.
+// ============================================================
+#include <cstdint>
+
+// ------------------------------------------------------------
+// Data access from the core; the SoC routes it
+// ------------------------------------------------------------
+class DataPort {
+public:
+    virtual ~DataPort() = default;
+    virtual uint32_t load(uint32_t addr, unsigned size) = 0;
+    virtual void     store(uint32_t addr, uint32_t data, unsigned size) = 0;
+};
+
+enum class Kind : uint8_t {
+    Alu,        // OP / OP-IMM / LUI / AUIPC
+    Jal,
+    Jalr,
+    Branch,
+    Load,       // LB..LHU, FLW
+    Store,      // SB..SW, FSW
+    Mul,
+    Div,
+    Fpu,
+    Csr,
+    Fence,
+    Wfi,
+    Mret,
+    Nop,        // ecall / ebreak / unsupported: no effect
+};
+
+struct Decoded {
+    uint32_t inst    = 0;
+    Kind     kind    = Kind::Nop;
+    uint8_t  opcode  = 0;
+    uint8_t  funct3  = 0;
+    uint8_t  rd      = 0;
+    uint8_t  rs1     = 0;
+    uint8_t  rs2     = 0;
+    uint8_t  rs3     = 0;
+    bool     rdInt   = false;   // writes x[rd]
+    bool     rdFp    = false;   // writes f[rd]
+    bool     rs1Int  = false;
+    bool     rs1Fp   = false;
+    bool     rs2Int  = false;
+    bool     rs2Fp   = false;
+    bool     rs3Fp   = false;
+    uint8_t  memSize = 0;       // bytes, loads and stores
+};
+
+Decoded decode(uint32_t inst);
+
+struct ExecResult {
+    uint32_t pc       = 0;
+    uint32_t nextPc   = 0;
+    bool     taken    = false;  // control transfer taken (rTaken)
+    uint32_t target   = 0;      // branch / jump target (bTarget)
+    bool     memWrite = false;
+    uint32_t memAddr  = 0;
+};
+
+class Core {
+public:
+    explicit Core(uint32_t hartId = 0) : hartId_(hartId) { reset(0); }
+
+    void reset(uint32_t resetPc);
+
+    // Execute d at pc; d must be decode(inst at pc)
+    void execute(const Decoded &d, DataPort &port, ExecResult &r);
+
+    // Interrupt state as seen by Controller_EX
+    bool     interruptPending() const;
+    unsigned pendingCause() const;
+    uint32_t vector(unsigned cause) const;
+    void     takeInterrupt(uint32_t mepcValue);
+    bool     mretChains() const;     // mret with MPIE and a pending source
+    void     chainInterrupt();
+
+    uint32_t pc = 0;
+    uint32_t x[32] = {};
+    uint32_t f[32] = {};
+
+    uint32_t mstatus = 0, mie = 0, mtvec = 0, mepc = 0, mcause = 0, mip = 0;
+    uint64_t cycle = 0, instret = 0;
+
+private:
+    uint32_t csrRead(uint32_t idx) const;
+    void     csrWrite(uint32_t idx, uint32_t v);
+    uint32_t fpu(const Decoded &d, bool &writesInt);
+
+    uint32_t hartId_;
+};
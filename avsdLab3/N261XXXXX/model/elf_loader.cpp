@@ -0,0 +1,90 @@
+#include "elf_loader.h"
+
+#include <fstream>
+#include <iterator>
+#include <vector>
+
+namespace {
+
+// ------------------------------------------------------------
+// ELF32 little-endian field access
+// ------------------------------------------------------------
+uint32_t rd32(const std::vector<uint8_t> &b, size_t off) {
+    return uint32_t(b[off]) | (uint32_t(b[off + 1]) << 8) |
+           (uint32_t(b[off + 2]) << 16) | (uint32_t(b[off + 3]) << 24);
+}
+
+uint16_t rd16(const std::vector<uint8_t> &b, size_t off) {
+    return uint16_t(b[off] | (b[off + 1] << 8));
+}
+
+constexpr uint32_t PT_LOAD    = 1;
+constexpr uint32_t SHT_SYMTAB = 2;
+constexpr uint16_t EM_RISCV   = 243;
+
+}  // namespace
+
+bool loadElf(const std::string &path, Memory &mem, ElfImage &image, std::string &error) {
+    std::ifstream f(path, std::ios::binary);
+    if (!f) {
+        error = "cannot open " + path;
+        return false;
+    }
+    std::vector<uint8_t> b((std::istreambuf_iterator<char>(f)), std::istreambuf_iterator<char>());
+
+    if (b.size() < 52 || b[0] != 0x7f || b[1] != 'E' || b[2] != 'L' || b[3] != 'F') {
+        error = path + ": not an ELF file";
+        return false;
+    }
+    if (b[4] != 1 || b[5] != 1 || rd16(b, 18) != EM_RISCV) {
+        error = path + ": not a little-endian ELF32 RISC-V image";
+        return false;
+    }
+
+    image.entry = rd32(b, 24);
+    uint32_t phoff = rd32(b, 28), shoff = rd32(b, 32);
+    uint16_t phentsize = rd16(b, 42), phnum = rd16(b, 44);
+    uint16_t shentsize = rd16(b, 46), shnum = rd16(b, 48);
+
+    // ---------------------------------------
+    // Program headers: load images
+    // ---------------------------------------
+    for (uint16_t i = 0; i < phnum; i++) {
+        size_t ph = phoff + size_t(i) * phentsize;
+        if (ph + 32 > b.size()) break;
+        if (rd32(b, ph) != PT_LOAD) continue;
+        uint32_t offset = rd32(b, ph + 4);
+        uint32_t paddr  = rd32(b, ph + 12);
+        uint32_t filesz = rd32(b, ph + 16);
+        if (size_t(offset) + filesz > b.size()) {
+            error = path + ": truncated segment";
+            return false;
+        }
+        mem.load(paddr, b.data() + offset, filesz);
+    }
+
+    // ---------------------------------------
+    // Section headers: symbol table
+    // ---------------------------------------
+    for (uint16_t i = 0; i < shnum; i++) {
+        size_t sh = shoff + size_t(i) * shentsize;
+        if (sh + 40 > b.size()) break;
+        if (rd32(b, sh + 4) != SHT_SYMTAB) continue;
+        uint32_t symoff = rd32(b, sh + 16), symsize = rd32(b, sh + 20);
+        uint32_t link = rd32(b, sh + 24), entsize = rd32(b, sh + 36);
+        size_t strsh = shoff + size_t(link) * shentsize;
+        if (entsize == 0 || strsh + 40 > b.size()) continue;
+        uint32_t stroff = rd32(b, strsh + 16);
+        for (uint32_t s = 0; s + entsize <= symsize; s += entsize) {
+            size_t sym = symoff + s;
+            if (sym + 16 > b.size()) break;
+            uint32_t name = rd32(b, sym);
+            size_t   p    = size_t(stroff) + name;
+            if (name == 0 || p >= b.size()) continue;
+            std::string n;
+            while (p < b.size() && b[p]) n += char(b[p++]);
+            image.symbols.emplace(n, rd32(b, sym + 4));
+        }
+    }
+    return true;
+}
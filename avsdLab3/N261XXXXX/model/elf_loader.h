@@ -0,0 +1,28 @@
+#pragma once
+#include <cstdint>
+#include <map>
+#include <string>
+
+#include "memory.h"
+
+// ============================================================
+// ELF32 Loader
+// ------------------------------------------------------------
+// Copies every PT_LOAD segment to its load (physical) address,
+// the same image objcopy puts in rom*.hex / dram*.hex, and
+// collects the symbol table so the run can find _sim_end and
+// _test_start.
+// ============================================================
+struct ElfImage {
+    uint32_t                        entry = 0;
+    std::map<std::string, uint32_t> symbols;
+
+    bool symbol(const std::string &name, uint32_t &value) const {
+        auto it = symbols.find(name);
+        if (it == symbols.end()) return false;
+        value = it->second;
+        return true;
+    }
+};
+
+bool loadElf(const std::string &path, Memory &mem, ElfImage &image, std::string &error);
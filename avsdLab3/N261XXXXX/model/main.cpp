@@ -0,0 +1,240 @@
+// ============================================================
+// socmodel: cycle-approximate model of the lab3 SoC
+// ------------------------------------------------------------
+//   socmodel [options] <elf>
+//     --golden FILE       check DRAM at _test_start against FILE
+//     --set NAME=V        override a knob (repeatable)
+//     --sweep NAME=A,B,.. run every value (repeatable; the runs
+//                         are the cross product of all sweeps)
+//     -j N                sweep worker threads (default: all cores)
+//     --list              list knobs with their defaults
+//     -v                  per-run counters
+//
+// A single run prints its counters; a sweep prints one CSV row
+// per configuration, fastest first. The model is uncalibrated
+// against RTL (see README).
+// ============================================================
+#include <algorithm>
+#include <atomic>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "config.h"
+#include "elf_loader.h"
+#include "memory.h"
+#include "soc.h"
+
+namespace {
+
+struct Sweep {
+    std::string              name;
+    std::vector<std::string> values;
+};
+
+struct Result {
+    Config   cfg;
+    RunStats st;
+    unsigned err = 0;
+};
+
+void usage() {
+    std::fprintf(stderr,
+                 "usage: socmodel [--golden FILE] [--set NAME=V]... [--sweep NAME=A,B,...]...\n"
+                 "                [-j N] [-v] <elf>\n"
+                 "       socmodel --list\n");
+}
+
+void listKnobs() {
+    Config def;
+    for (const Knob &k : knobs())
+        std::printf("  %-18s %8lld   %s\n", k.name, (long long)(def.*k.field), k.help);
+}
+
+bool readGolden(const std::string &path, std::vector<uint32_t> &golden) {
+    std::ifstream in(path);
+    if (!in) return false;
+    std::string line;
+    while (std::getline(in, line)) {
+        if (line.find_first_not_of(" \t\r") == std::string::npos) continue;
+        golden.push_back(uint32_t(std::strtoul(line.c_str(), nullptr, 16)));
+    }
+    return true;
+}
+
+Result runOne(const Config &cfg, const Memory &image, const ElfImage &elf,
+              const std::vector<uint32_t> &golden) {
+    Result r;
+    r.cfg = cfg;
+    Soc soc(cfg, image, elf);
+    r.st  = soc.run();
+    r.err = soc.goldenErrors(golden);
+    return r;
+}
+
+void printStats(const Result &r, size_t goldenWords, bool verbose) {
+    const RunStats &s = r.st;
+    double ipc = s.cycles ? double(s.instret) / double(s.cycles) : 0.0;
+    std::printf("%-16s %llu%s\n", "cycles", (unsigned long long)s.cycles,
+                s.finished ? "" : "  (did not reach _sim_end)");
+    std::printf("%-16s %llu\n", "instret", (unsigned long long)s.instret);
+    std::printf("%-16s %.4f\n", "IPC", ipc);
+    if (verbose) {
+        std::printf("%-16s %llu / %llu\n", "mispredicts",
+                    (unsigned long long)s.mispredicts, (unsigned long long)s.ctrlOps);
+        std::printf("%-16s %llu\n", "load-use", (unsigned long long)s.loadUseStalls);
+        std::printf("%-16s %llu\n", "fetch bubbles", (unsigned long long)s.fetchBubbles);
+        std::printf("%-16s %llu\n", "MEM stalls", (unsigned long long)s.memStalls);
+        std::printf("%-16s %llu\n", "fused", (unsigned long long)s.fused);
+        std::printf("%-16s %llu\n", "SB drains", (unsigned long long)s.sbDrains);
+        std::printf("%-16s %llu hit / %llu miss / %llu stream\n", "DRAM rows",
+                    (unsigned long long)s.dramRowHits, (unsigned long long)s.dramRowMisses,
+                    (unsigned long long)s.dramStreamHits);
+        std::printf("%-16s %llu\n", "interrupts", (unsigned long long)s.interrupts);
+        if (s.resyncs) std::printf("%-16s %llu\n", "resyncs", (unsigned long long)s.resyncs);
+    }
+    if (goldenWords)
+        std::printf("%-16s %zu/%zu %s\n", "golden", goldenWords - r.err, goldenWords,
+                    r.err ? "FAIL" : "PASS");
+}
+
+}  // namespace
+
+int main(int argc, char **argv) {
+    Config                base;
+    std::vector<Sweep>    sweeps;
+    std::string           elfPath, goldenPath, error;
+    unsigned              jobs    = std::max(1u, std::thread::hardware_concurrency());
+    bool                  verbose = false;
+
+    for (int i = 1; i < argc; i++) {
+        std::string a = argv[i];
+        auto value = [&]() -> std::string {
+            if (i + 1 >= argc) {
+                usage();
+                std::exit(2);
+            }
+            return argv[++i];
+        };
+        if (a == "--list") {
+            listKnobs();
+            return 0;
+        } else if (a == "--golden") {
+            goldenPath = value();
+        } else if (a == "--set") {
+            if (!base.set(value(), error)) {
+                std::fprintf(stderr, "socmodel: %s\n", error.c_str());
+                return 2;
+            }
+        } else if (a == "--sweep") {
+            std::string s  = value();
+            size_t      eq = s.find('=');
+            if (eq == std::string::npos) {
+                std::fprintf(stderr, "socmodel: expected NAME=A,B,..., got '%s'\n", s.c_str());
+                return 2;
+            }
+            Sweep sw{s.substr(0, eq), {}};
+            for (size_t p = eq + 1, q; p <= s.size(); p = q + 1) {
+                q = s.find(',', p);
+                if (q == std::string::npos) q = s.size();
+                sw.values.push_back(s.substr(p, q - p));
+            }
+            for (const std::string &v : sw.values) {
+                Config probe;
+                if (!probe.set(sw.name + "=" + v, error)) {
+                    std::fprintf(stderr, "socmodel: %s\n", error.c_str());
+                    return 2;
+                }
+            }
+            sweeps.push_back(sw);
+        } else if (a == "-j") {
+            jobs = unsigned(std::max(1l, std::strtol(value().c_str(), nullptr, 0)));
+        } else if (a == "-v") {
+            verbose = true;
+        } else if (!a.empty() && a[0] == '-') {
+            usage();
+            return 2;
+        } else {
+            elfPath = a;
+        }
+    }
+    if (elfPath.empty()) {
+        usage();
+        return 2;
+    }
+
+    Memory   image;
+    ElfImage elf;
+    if (!loadElf(elfPath, image, elf, error)) {
+        std::fprintf(stderr, "socmodel: %s\n", error.c_str());
+        return 2;
+    }
+    std::vector<uint32_t> golden;
+    if (!goldenPath.empty() && !readGolden(goldenPath, golden)) {
+        std::fprintf(stderr, "socmodel: cannot read %s\n", goldenPath.c_str());
+        return 2;
+    }
+
+    // ---------------------------------------
+    // Single run
+    // ---------------------------------------
+    if (sweeps.empty()) {
+        Result r = runOne(base, image, elf, golden);
+        printStats(r, golden.size(), verbose);
+        return (r.st.finished && !r.err) ? 0 : 1;
+    }
+
+    // ---------------------------------------
+    // Sweep: cross product, fastest first
+    // ---------------------------------------
+    std::vector<Config> configs{base};
+    for (const Sweep &sw : sweeps) {
+        std::vector<Config> grown;
+        for (const Config &c : configs) {
+            for (const std::string &v : sw.values) {
+                Config n = c;
+                n.set(sw.name + "=" + v, error);
+                grown.push_back(n);
+            }
+        }
+        configs.swap(grown);
+    }
+
+    std::vector<Result>  results(configs.size());
+    std::atomic<size_t>  next{0};
+    std::vector<std::thread> pool;
+    for (unsigned t = 0; t < std::min<size_t>(jobs, configs.size()); t++) {
+        pool.emplace_back([&]() {
+            for (size_t i; (i = next++) < configs.size();)
+                results[i] = runOne(configs[i], image, elf, golden);
+        });
+    }
+    for (std::thread &t : pool) t.join();
+
+    std::stable_sort(results.begin(), results.end(), [](const Result &a, const Result &b) {
+        bool aOk = a.st.finished && !a.err, bOk = b.st.finished && !b.err;
+        if (aOk != bOk) return aOk;
+        return a.st.cycles < b.st.cycles;
+    });
+
+    std::printf("rank");
+    for (const Sweep &sw : sweeps) std::printf(",%s", sw.name.c_str());
+    std::printf(",cycles,instret,ipc,mispredicts,status\n");
+    for (size_t i = 0; i < results.size(); i++) {
+        const Result &r = results[i];
+        std::printf("%zu", i + 1);
+        for (const Sweep &sw : sweeps) {
+            for (const Knob &k : knobs())
+                if (sw.name == k.name) std::printf(",%lld", (long long)(r.cfg.*k.field));
+        }
+        std::printf(",%llu,%llu,%.4f,%llu,%s\n", (unsigned long long)r.st.cycles,
+                    (unsigned long long)r.st.instret,
+                    r.st.cycles ? double(r.st.instret) / double(r.st.cycles) : 0.0,
+                    (unsigned long long)r.st.mispredicts,
+                    !r.st.finished ? "timeout" : r.err ? "fail" : "pass");
+    }
+    return 0;
+}
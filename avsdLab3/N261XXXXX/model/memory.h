@@ -0,0 +1,91 @@
+#pragma once
+// ============================================================
+// SoC Address Map and Backing Store
+// ------------------------------------------------------------
+// Same windows as Request_Decoder. Only the memories hold
+// data here; device windows are decoded for timing and their
+// registers live in the device models (soc.cpp).
+// ============================================================
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+enum SlaveId : int {
+    S_ROM = 0,
+    S_IM,
+    S_DM,
+    S_DMA,
+    S_WDT,
+    S_DRAM,
+    S_PIX,
+    S_HSEM,
+    S_DEFAULT,
+    NUM_SLAVES
+};
+
+struct Window {
+    uint32_t begin, end;
+};
+
+static const Window kSlaveWindow[S_DEFAULT] = {
+    {0x0000'0000u, 0x0000'1FFFu},   // ROM
+    {0x0001'0000u, 0x0001'FFFFu},   // IM
+    {0x0002'0000u, 0x0002'FFFFu},   // DM
+    {0x1002'0000u, 0x1002'0200u},   // DMA
+    {0x1001'0000u, 0x1001'03FFu},   // WDT
+    {0x2000'0000u, 0x201F'FFFFu},   // DRAM
+    {0x1003'0000u, 0x1003'2FFFu},   // PIX
+    {0x1004'0000u, 0x1004'0FFFu},   // HSEM
+};
+
+inline SlaveId decodeSlave(uint32_t addr) {
+    for (int s = 0; s < S_DEFAULT; s++)
+        if (addr >= kSlaveWindow[s].begin && addr <= kSlaveWindow[s].end)
+            return static_cast<SlaveId>(s);
+    return S_DEFAULT;
+}
+
+inline bool isDeviceAddr(uint32_t addr) { return (addr >> 28) == 0x1; }
+
+class Memory {
+public:
+    Memory()
+        : rom_(0x2000), im_(0x10000), dm_(0x10000), dram_(0x200000) {}
+
+    // Byte pointer, or nullptr outside ROM/IM/DM/DRAM
+    uint8_t *byte(uint32_t addr) {
+        switch (decodeSlave(addr)) {
+            case S_ROM:  return &rom_[addr - kSlaveWindow[S_ROM].begin];
+            case S_IM:   return &im_[addr - kSlaveWindow[S_IM].begin];
+            case S_DM:   return &dm_[addr - kSlaveWindow[S_DM].begin];
+            case S_DRAM: return &dram_[addr - kSlaveWindow[S_DRAM].begin];
+            default:     return nullptr;
+        }
+    }
+
+    uint32_t read(uint32_t addr, unsigned size) {
+        uint32_t v = 0;
+        for (unsigned i = 0; i < size; i++) {
+            const uint8_t *p = byte(addr + i);
+            v |= uint32_t(p ? *p : 0) << (8 * i);
+        }
+        return v;
+    }
+
+    // ROM ignores writes (the wrapper answers SLVERR)
+    void write(uint32_t addr, uint32_t data, unsigned size) {
+        for (unsigned i = 0; i < size; i++) {
+            if (decodeSlave(addr + i) == S_ROM) continue;
+            if (uint8_t *p = byte(addr + i)) *p = uint8_t(data >> (8 * i));
+        }
+    }
+
+    // Loader path: ROM is writable here
+    void load(uint32_t addr, const uint8_t *src, size_t n) {
+        for (size_t i = 0; i < n; i++)
+            if (uint8_t *p = byte(uint32_t(addr + i))) *p = src[i];
+    }
+
+private:
+    std::vector<uint8_t> rom_, im_, dm_, dram_;
+};
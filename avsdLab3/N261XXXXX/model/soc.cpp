@@ -0,0 +1,856 @@
+#include "soc.h"
+
+#include <algorithm>
+#include <limits>
+
+namespace {
+
+constexpr uint64_t kLocked  = std::numeric_limits<uint64_t>::max();
+constexpr uint32_t MIP_MTIP = 1u << 7;
+constexpr uint32_t MIP_MEIP = 1u << 11;
+
+// Device register offsets
+constexpr uint32_t DMA_EN_OFF   = 0x100, DMA_DESC_OFF = 0x200;
+constexpr uint32_t WDT_EN_OFF   = 0x100, WDT_LIVE_OFF = 0x200, WDT_CNT_OFF = 0x300;
+constexpr uint32_t HSEM_MBOX    = 0x100, HSEM_MSTAT   = 0x200;
+
+// Opcodes Controller_ID fuses on (inst[6:0])
+constexpr uint32_t OPC_LUI = 0x37, OPC_AUIPC = 0x17, OPC_IMM = 0x13, OPC_OP = 0x33;
+constexpr uint32_t OPC_JALR = 0x67, OPC_BRANCH = 0x63;
+
+uint32_t field(uint32_t inst, unsigned lo, unsigned bits) {
+    return (inst >> lo) & ((1u << bits) - 1);
+}
+
+}  // namespace
+
+Soc::Soc(const Config &cfg, const Memory &image, const ElfImage &elf)
+    : cfg_(cfg), mem_(image),
+      bp_(unsigned(cfg.btb_entries), unsigned(cfg.pht_entries)),
+      streams_(size_t(cfg.dram_streams)),
+      pixRegs_((kSlaveWindow[S_PIX].end - kSlaveWindow[S_PIX].begin + 1) / 4) {
+    if (!elf.symbol("_sim_end", simEnd_))      simEnd_    = 0x0002'FFFCu;
+    if (!elf.symbol("_test_start", testStart_)) testStart_ = 0x2010'0000u;
+    core_.reset(0);
+}
+
+// ============================================================
+// Run
+// ------------------------------------------------------------
+// Cycle 0 is the first cycle after reset: both CPU masters sit
+// in IDLE and issue from cycle 1, as in CPU_wrapper.
+// ============================================================
+RunStats Soc::run() {
+    uint64_t c = 0;
+    while (c < uint64_t(cfg_.max_cycles)) {
+        postRequests(c);
+        arbitrate(c);
+        dramPrefetch(c);
+        stepPipeline(c);
+        stepDma(c);
+        stepWdt(c);
+        core_.cycle = ++c;
+        if (simEndVisible()) {
+            st_.finished = true;
+            break;
+        }
+    }
+    st_.cycles  = c;
+    st_.instret = core_.instret;
+    return st_;
+}
+
+unsigned Soc::goldenErrors(const std::vector<uint32_t> &golden) {
+    unsigned err = 0;
+    for (size_t i = 0; i < golden.size(); i++)
+        if (mem_.read(testStart_ + uint32_t(4 * i), 4) != golden[i]) err++;
+    return err;
+}
+
+// The end marker counts once it has left MEM and the store
+// buffer, i.e. it is in DM where top_tb polls it
+bool Soc::simEndVisible() {
+    if (mem_.read(simEnd_, 4) != 0xFFFF'FFFFu) return false;
+    uint32_t word = simEnd_ & ~3u;
+    if (mem1_.valid && mem1_.kind == MEM_STORE && (mem1_.addr & ~3u) == word) return false;
+    bool hit;
+    return !sbLookup(word, hit);
+}
+
+// ============================================================
+// Functional Data Port
+// ------------------------------------------------------------
+// Memory is read and written at EX. Device reads return the
+// register value at EX; device writes are held for MEM and
+// take effect at their W beat.
+// ============================================================
+uint32_t Soc::load(uint32_t addr, unsigned size) {
+    if (!isDeviceAddr(addr)) return mem_.read(addr, size);
+
+    uint32_t off = addr - kSlaveWindow[decodeSlave(addr)].begin;
+    switch (decodeSlave(addr)) {
+        case S_PIX:
+            return pixRegs_[off >> 2];
+        case S_HSEM:
+            if (off < HSEM_MBOX) {
+                uint32_t &lock = hsemLock_[(off >> 2) & 15];
+                uint32_t  old  = lock;
+                lock = 1;
+                return old;
+            }
+            if (off < HSEM_MSTAT) {
+                unsigned h = (off >> 2) & 3;
+                hsemFull_[h] = false;
+                return hsemMbox_[h];
+            }
+            return hsemFull_[(off >> 2) & 3];
+        default:
+            return 0;
+    }
+}
+
+void Soc::store(uint32_t addr, uint32_t data, unsigned size) {
+    if (isDeviceAddr(addr)) {
+        storeDevData_ = data;
+        return;
+    }
+    mem_.write(addr, data, size);
+}
+
+void Soc::deviceWrite(uint32_t addr, uint32_t data, uint64_t c) {
+    uint32_t off = addr - kSlaveWindow[decodeSlave(addr)].begin;
+    switch (decodeSlave(addr)) {
+        case S_DMA:
+            if (off == DMA_EN_OFF) {
+                if (data & 1) dmaStart_ = true;
+                else          dmaIrq_   = false;
+            } else if (off == DMA_DESC_OFF) {
+                dmaDesc_ = data;
+            }
+            break;
+        case S_WDT: {
+            // Async FIFO: visible on the second clk2 edge after the write
+            uint64_t ratio = uint64_t(cfg_.wdt_ratio);
+            uint64_t edge  = c / ratio + 2;
+            unsigned reg   = off == WDT_EN_OFF ? 1 : off == WDT_LIVE_OFF ? 2 : off == WDT_CNT_OFF ? 3 : 0;
+            if (reg) wdtFifo_.push_back({edge, reg, data});
+            break;
+        }
+        case S_PIX:
+            pixRegs_[off >> 2] = data;
+            break;
+        case S_HSEM:
+            if (off < HSEM_MBOX) {
+                if (data == 0) hsemLock_[(off >> 2) & 15] = 0;
+            } else if (off < HSEM_MSTAT) {
+                hsemMbox_[(off >> 2) & 3] = data;
+                hsemFull_[(off >> 2) & 3] = true;
+            }
+            break;
+        default:
+            break;
+    }
+}
+
+// ============================================================
+// Master Requests
+// ------------------------------------------------------------
+// What each master drives on AR / AW this cycle, from state at
+// the start of the cycle.
+// ============================================================
+void Soc::postRequests(uint64_t c) {
+    for (int m = 0; m < NUM_MASTERS; m++) {
+        reqR_[m] = Request();
+        reqW_[m] = Request();
+    }
+
+    // ---------------------------------------
+    // M0: a burst to the end of the aligned
+    // 4-word block, once the queue has room
+    // for every beat
+    // ---------------------------------------
+    unsigned ifBeats = 4 - ((fetchPc_ >> 2) & 3);
+    ifValid_ = !ifValidN_ && ifq_.size() + ifBeats <= size_t(cfg_.ifq_depth);
+    if (m0_ == M0_ADDR && ifValid_ && c >= fetchHold_)
+        reqR_[M_IF] = {true, fetchPc_, ifBeats};
+
+    // ---------------------------------------
+    // M1: load, direct device store or a
+    // store buffer drain
+    // ---------------------------------------
+    uint32_t a     = mem1_.upper ? (mem1_.addr & ~3u) + 4 : mem1_.addr;
+    bool     dev   = isDeviceAddr(a);
+    bool     ld    = mem1_.valid && mem1_.kind == MEM_LOAD;
+    bool     stv   = mem1_.valid && mem1_.kind == MEM_STORE;
+    bool     fence = mem1_.valid && mem1_.kind == MEM_FENCE;
+    bool     hit;
+    bool     overlap = sbLookup(a, hit);
+
+    bool force = fence || (stv && dev) || (ld && dev) || (ld && !dev && overlap && !hit);
+    drainCond_ = sbDrainCond(force);
+    drainReq_  = sbHeadLock_ || drainCond_;
+    loadGo_ = directGo_ = drainGo_ = false;
+    if (m1_ == M1_ADDR) {
+        loadGo_   = ld && !awHold_ && (dev ? sb_.empty() : !overlap);
+        directGo_ = stv && dev && sb_.empty();
+        drainGo_  = drainReq_ && (awHold_ || !loadGo_);
+        if (loadGo_) {
+            reqR_[M_MEM] = {true, a, 1};
+        } else if (drainGo_) {
+            uint32_t addr;
+            unsigned beats;
+            sbDrainBurst(addr, beats);
+            reqW_[M_MEM] = {true, addr, beats};
+        } else if (directGo_) {
+            reqW_[M_MEM] = {true, a, 1};
+        }
+    }
+
+    // ---------------------------------------
+    // M2: descriptor fetch, then AR and AW of
+    // each burst (each held until accepted)
+    // ---------------------------------------
+    if (dma_ == DMA_DESC_AR) {
+        reqR_[M_DMA] = {true, dmaDesc_, 5};
+    } else if (dma_ == DMA_XFER_AR) {
+        if (!dmaArDone_) reqR_[M_DMA] = {true, dmaSrc_, dmaBeats_};
+        if (!dmaAwDone_) reqW_[M_DMA] = {true, dmaDst_, dmaBeats_};
+    }
+}
+
+// ============================================================
+// Arbiter
+// ------------------------------------------------------------
+// A free slave takes the highest-numbered master asking for it,
+// read before write within a master, and stays locked until its
+// last beat (read) or B (write) is done.
+// ============================================================
+void Soc::arbitrate(uint64_t c) {
+    for (int m = 0; m < NUM_MASTERS; m++) {
+        grantR_[m] = Burst();
+        grantW_[m] = Burst();
+    }
+    dramGranted_ = false;
+
+    for (int s = 0; s < NUM_SLAVES; s++) {
+        if (c < freeAt_[s]) continue;
+        int  win   = -1;
+        bool write = false;
+        for (int m = 0; m < NUM_MASTERS; m++) {
+            if (reqR_[m].valid && decodeSlave(reqR_[m].addr) == s) {
+                win = m;
+                write = false;
+            } else if (reqW_[m].valid && decodeSlave(reqW_[m].addr) == s) {
+                win = m;
+                write = true;
+            }
+        }
+        if (win < 0) continue;
+
+        const Request &rq = write ? reqW_[win] : reqR_[win];
+        Burst b = accept(SlaveId(s), win, write, rq.addr, rq.beats, c);
+        (write ? grantW_ : grantR_)[win] = b;
+        if (s == S_DRAM) dramGranted_ = true;
+
+        // A DMA transfer burst is paced by its partner; the slave is
+        // released once the lockstep is known (stepDma)
+        if (win == M_DMA && dma_ == DMA_XFER_AR) freeAt_[s] = kLocked;
+        else                                     freeAt_[s] = write ? b.last + 2 : b.last + 1;
+    }
+}
+
+// ============================================================
+// Slave Timing
+// ------------------------------------------------------------
+// t is the AR/AW handshake cycle. SRAM-style wrappers answer
+// from t + lat, one beat per cycle. DRAM_wrapper pays the row
+// state on the first beat and CAS per beat; a read the stream
+// buffer covers is answered one beat per cycle.
+// ============================================================
+Soc::Burst Soc::accept(SlaveId s, int master, bool write, uint32_t addr, unsigned beats, uint64_t t) {
+    Burst b;
+    b.active = true;
+    b.slave  = s;
+    b.write  = write;
+    b.addr   = addr;
+    b.beats  = beats;
+    b.gap    = 1;
+
+    switch (s) {
+        case S_ROM:
+            b.first = t + uint64_t(cfg_.rom_lat);
+            break;
+        case S_IM:
+        case S_DM:
+            b.first = t + uint64_t(cfg_.sram_lat);
+            break;
+        case S_DRAM: {
+            uint32_t row  = (addr >> 12) & 0x7FF;
+            uint32_t word = (addr >> 2) & 0x1F'FFFF;
+            uint64_t cl   = uint64_t(cfg_.dram_cl);
+            uint64_t cdc  = 2 * uint64_t(cfg_.dram_cdc);
+            bool     rowHit = dramRowOpen_ && dramRow_ == row;
+            uint64_t rowDelay = !dramRowOpen_ ? uint64_t(cfg_.dram_trcd)
+                              : rowHit        ? 0
+                                              : uint64_t(cfg_.dram_trp + cfg_.dram_trcd);
+            if (rowHit) st_.dramRowHits++;
+            else        st_.dramRowMisses++;
+
+            if (write) {
+                b.first = t + cdc + (rowDelay ? rowDelay + cl - 1 : cl);
+                b.gap   = unsigned(cl);
+                // Drop buffered words the write overlaps
+                uint32_t lo = word, hi = word + beats - 1;
+                for (Stream &st : streams_)
+                    if (st.cnt && lo < st.next + st.cnt && hi >= st.next) st.cnt = 0;
+            } else {
+                // The slave-side ID carries the master index, so each
+                // master follows its own stream
+                uint32_t id    = uint32_t(master) << 4;
+                int      found = -1;
+                for (size_t i = 0; i < streams_.size(); i++)
+                    if (streams_[i].valid && streams_[i].id == id) found = int(i);
+                if (found >= 0) {
+                    Stream &st  = streams_[size_t(found)];
+                    bool    seq = word == st.next;
+                    st.hit = rowHit && seq && st.cnt >= beats;
+                    if (st.hit) {
+                        b.first = t + 1 + cdc;
+                        st.cnt -= beats;
+                        st_.dramStreamHits++;
+                    } else {
+                        b.first = t + cdc + rowDelay + cl;
+                        b.gap   = unsigned(cl + 1);
+                        st.cnt  = 0;
+                    }
+                    st.len   = beats;
+                    st.next  = word + beats;
+                    st.armed = seq;
+                } else {
+                    b.first = t + cdc + rowDelay + cl;
+                    b.gap   = unsigned(cl + 1);
+                    if (!streams_.empty()) {
+                        streams_[streamVictim_] = Stream{true, false, id, word + beats, 0, false, beats};
+                        streamVictim_ = (streamVictim_ + 1) % unsigned(streams_.size());
+                    }
+                }
+            }
+            dramRowOpen_ = true;
+            dramRow_     = row;
+            break;
+        }
+        default:
+            b.first = t + uint64_t(cfg_.dev_lat);
+            break;
+    }
+    b.last = b.first + uint64_t(beats - 1) * b.gap;
+    return b;
+}
+
+// Read-ahead: an idle DRAM with its row open fetches the next
+// word of an armed stream that is not full, CAS + 1 cycles.
+// Past its last burst length a stream only reads ahead while
+// its last AR hit.
+void Soc::dramPrefetch(uint64_t c) {
+    if (dramGranted_ || c < freeAt_[S_DRAM] || !dramRowOpen_) return;
+    for (Stream &st : streams_) {
+        if (st.valid && st.armed && st.cnt != unsigned(cfg_.dram_stream_depth)
+            && (st.hit || st.cnt < st.len)
+            && ((st.next + st.cnt) >> 10) == dramRow_) {
+            st.cnt++;
+            freeAt_[S_DRAM] = c + uint64_t(cfg_.dram_cl) + 2;
+            return;
+        }
+    }
+}
+
+// ============================================================
+// Store Buffer
+// ============================================================
+bool Soc::sbLookup(uint32_t addr, bool &hit) const {
+    uint32_t lineBytes = uint32_t(cfg_.sb_line_words) * 4;
+    uint32_t tag  = addr / lineBytes;
+    unsigned w    = (addr % lineBytes) >> 2;
+    uint8_t  have = 0;
+    for (const SbEntry &e : sb_)
+        if (e.tag == tag) have |= e.strb[w];
+    hit = have == 0xF;
+    return have != 0;
+}
+
+int Soc::sbMergeIdx(uint32_t tag, bool drainReq) const {
+    for (size_t i = 0; i < sb_.size(); i++) {
+        if (i == 0 && drainReq) continue;
+        if (sb_[i].tag == tag) return int(i);
+    }
+    return -1;
+}
+
+bool Soc::sbDrainCond(bool force) const {
+    if (sb_.empty()) return false;
+    bool headFull = std::all_of(sb_.front().strb.begin(), sb_.front().strb.end(),
+                                [](uint8_t m) { return m == 0xF; });
+    return sb_.size() > 1 || headFull || sbAge_ == unsigned(cfg_.sb_drain_age) || force;
+}
+
+// Head entry as one burst from its first to its last written word
+void Soc::sbDrainBurst(uint32_t &addr, unsigned &beats) const {
+    const SbEntry &e = sb_.front();
+    unsigned first = 0, last = 0;
+    bool     any   = false;
+    for (unsigned w = 0; w < e.strb.size(); w++) {
+        if (!e.strb[w]) continue;
+        if (!any) first = w;
+        last = w;
+        any  = true;
+    }
+    addr  = e.tag * uint32_t(cfg_.sb_line_words) * 4 + first * 4;
+    beats = last - first + 1;
+}
+
+// ============================================================
+// Fusion / Hazard (Controller_ID, Hazard_Unit)
+// ============================================================
+bool Soc::fusable(const FetchEntry &a, const FetchEntry &b) const {
+    uint32_t i1 = a.inst, i2 = b.inst;
+    uint32_t op1 = field(i1, 0, 7), op2 = field(i2, 0, 7);
+    uint32_t rd1 = field(i1, 7, 5), rd2 = field(i2, 7, 5);
+    uint32_t rs1 = field(i2, 15, 5), rs2 = field(i2, 20, 5);
+    uint32_t f31 = field(i1, 12, 3), f32 = field(i2, 12, 3);
+    if (a.pTaken || rd1 == 0) return false;
+
+    bool isLui   = op1 == OPC_LUI;
+    bool isAuipc = op1 == OPC_AUIPC;
+    bool isSlli  = op1 == OPC_IMM && f31 == 1 && (i1 >> 25) == 0
+                && field(i1, 20, 5) != 0 && field(i1, 22, 3) == 0;
+    bool isSlt   = op1 == OPC_OP && (f31 >> 1) == 1 && (i1 >> 25) == 0;
+
+    bool isAddi  = op2 == OPC_IMM && f32 == 0 && rd2 == rd1 && rs1 == rd1;
+    bool isJalr  = op2 == OPC_JALR && rd2 == rd1 && rs1 == rd1;
+    bool isAdd   = op2 == OPC_OP && f32 == 0 && (i2 >> 25) == 0 && rd2 == rd1
+                && ((rs1 == rd1) != (rs2 == rd1));
+    bool isBeqz  = op2 == OPC_BRANCH && (f32 >> 1) == 0
+                && ((rs1 == rd1 && rs2 == 0) || (rs2 == rd1 && rs1 == 0));
+
+    return (isLui && isAddi) || (isAuipc && isJalr) || (isSlli && isAdd) || (isSlt && isBeqz);
+}
+
+// EX holds a load whose rd the ID head reads
+bool Soc::loadUse(const ExOp &ex, const FetchEntry &id) const {
+    if (!ex.valid || ex.fused) return false;
+    const Decoded &l = ex.d[0];
+    if (l.kind != Kind::Load || l.rd == 0) return false;
+    Decoded u = decode(id.inst);
+    if (l.rdFp)
+        return (u.rs1Fp && u.rs1 == l.rd) || (u.rs2Fp && u.rs2 == l.rd) || (u.rs3Fp && u.rs3 == l.rd);
+    return (u.rs1Int && u.rs1 == l.rd) || (u.rs2Int && u.rs2 == l.rd);
+}
+
+// ============================================================
+// Pipeline
+// ------------------------------------------------------------
+// MEM decides MEM_DONE, EX acts when EX_ready, ID feeds EX, IF
+// completes a fetch; then the store buffer and M0/M1 advance.
+// ============================================================
+void Soc::stepPipeline(uint64_t c) {
+    using BType = BranchPredictor::BType;
+
+    uint32_t lines = (dmaIrq_ ? MIP_MEIP : 0) | (wdtS2_ ? MIP_MTIP : 0);
+
+    // Prediction for a fetch completing now, before this cycle's update
+    bool     pTaken;
+    uint32_t pTarget;
+    bp_.lookup(fetchPc_, pTaken, pTarget);
+
+    // ---------------------------------------
+    // MEM
+    // ---------------------------------------
+    uint32_t memA   = mem1_.upper ? (mem1_.addr & ~3u) + 4 : mem1_.addr;
+    bool     memDev = isDeviceAddr(memA);
+    bool     hit;
+    sbLookup(memA, hit);
+
+    uint32_t lineBytes = uint32_t(cfg_.sb_line_words) * 4;
+    int      mergeIdx  = sbMergeIdx(memA / lineBytes, drainReq_);
+    bool     pushReady = mergeIdx >= 0 || sb_.size() < size_t(cfg_.sb_entries);
+    bool     sbPush    = false;
+
+    unsigned pushMask = ((1u << mem1_.size) - 1) << (mem1_.addr & 3);
+    uint8_t  pushStrb = uint8_t(mem1_.upper ? pushMask >> 4 : pushMask & 0xF);
+
+    // A direct device store lands at its W beat
+    if (m1_ == M1_WRITE && !m1Drain_ && c == m1Burst_.first)
+        deviceWrite(m1Burst_.addr, mem1_.data, c);
+
+    bool memDone = false;
+    if (m1_ == M1_IDLE) {
+        memDone = false;
+    } else if (!mem1_.valid) {
+        memDone = true;
+    } else if (mem1_.kind == MEM_FENCE) {
+        memDone = sb_.empty();
+    } else if (mem1_.kind == MEM_STORE) {
+        if (!memDev) memDone = sbPush = pushReady;
+        else         memDone = m1_ == M1_WRITE && !m1Drain_ && c == m1Burst_.last + 1;
+    } else {
+        memDone = (!memDev && hit) || (m1_ == M1_READ && c == m1Burst_.last);
+    }
+    bool memReady = memDone && !(mem1_.split && !mem1_.upper);
+    if (!memReady) st_.memStalls++;
+
+    // ---------------------------------------
+    // EX
+    // ---------------------------------------
+    bool exBusy = ex_.valid && ex_.wait > 0;
+    if (exBusy) ex_.wait--;
+    bool exReady = memReady && !exBusy;
+
+    bool     redirect = false, flushID = false, flushEX = false;
+    bool     stallID = false, stallEX = false, exIfValidN = false;
+    uint32_t fTarget = 0;
+    MemOp    next;
+
+    if (exReady) {
+        ExOp &op   = ex_;
+        Kind  k0   = op.d[0].kind;
+        bool  wfi  = op.valid && !op.fused && k0 == Kind::Wfi;
+        bool  mret = op.valid && !op.fused && k0 == Kind::Mret;
+
+        auto flushTo = [&](uint32_t target) {
+            redirect = flushID = flushEX = true;
+            fTarget  = target;
+        };
+
+        if (op.valid && op.pc != core_.pc) {
+            // Wrong-path op the model failed to squash
+            st_.resyncs++;
+            flushTo(core_.pc);
+        } else if (op.valid && core_.interruptPending()) {
+            core_.takeInterrupt(wfi ? op.pc + 4 : op.pc);
+            st_.interrupts++;
+            flushTo(core_.pc);
+        } else if (mret && core_.mretChains()) {
+            core_.chainInterrupt();
+            core_.instret++;
+            flushTo(core_.pc);
+        } else if (wfi) {
+            redirect = flushID = stallEX = exIfValidN = true;
+            fTarget  = 0;
+        } else if (op.valid) {
+            bool stall = !ifq_.empty() && loadUse(op, ifq_.front());
+
+            ExecResult r;
+            core_.execute(op.d[0], *this, r);
+            uint32_t memAddr = r.memAddr;
+            if (op.fused) core_.execute(op.d[1], *this, r);
+            core_.instret += op.fused ? 2 : 1;
+
+            Kind  kl = op.fused ? op.d[1].kind : k0;
+            BType bt = kl == Kind::Branch                              ? BranchPredictor::B_BRANCH
+                     : (kl == Kind::Jal || (op.fused && kl == Kind::Jalr)) ? BranchPredictor::B_JAL
+                                                                       : BranchPredictor::B_OTHER;
+            if (bt != BranchPredictor::B_OTHER) {
+                bp_.update(op.opPc, bt, r.taken, r.target);
+                st_.ctrlOps++;
+            }
+
+            if (!op.fused) {
+                const Decoded &d = op.d[0];
+                bool toMem = (k0 == Kind::Load && d.rd != 0) || k0 == Kind::Store || k0 == Kind::Fence;
+                if (toMem) {
+                    next.valid = true;
+                    next.kind  = k0 == Kind::Load ? MEM_LOAD : k0 == Kind::Store ? MEM_STORE : MEM_FENCE;
+                    next.addr  = memAddr;
+                    next.size  = d.memSize ? d.memSize : 4;
+                    next.split = k0 != Kind::Fence && !isDeviceAddr(memAddr) && (memAddr & 3) + next.size > 4;
+                    next.data  = storeDevData_;
+                }
+            }
+
+            bool ctrl   = kl == Kind::Jal || kl == Kind::Jalr || kl == Kind::Branch;
+            bool rTaken = ctrl && r.taken;
+            bool wrong  = rTaken != op.pTaken || (rTaken && op.pTaken && op.pTarget != r.target);
+            if (stall) {
+                stallID = flushEX = true;
+                st_.loadUseStalls++;
+            } else if (mret) {
+                flushTo(core_.pc);
+            } else if (wrong) {
+                st_.mispredicts++;
+                flushTo(core_.pc);
+            }
+        }
+
+        // ---------------------------------------
+        // ID -> EX
+        // ---------------------------------------
+        if (stallEX) {
+            // WFI holds EX
+        } else if (flushEX || stallID || flushID) {
+            ex_ = ExOp();
+        } else if (ifq_.empty()) {
+            ex_ = ExOp();
+            st_.fetchBubbles++;
+        } else {
+            FetchEntry a = ifq_.front();
+            ExOp       n;
+            n.valid = true;
+            n.pc    = a.pc;
+            n.d[0]  = decode(a.inst);
+            if (cfg_.fuse && ifq_.size() >= 2 && fusable(a, ifq_[1])) {
+                FetchEntry b = ifq_[1];
+                n.fused   = true;
+                n.d[1]    = decode(b.inst);
+                n.opPc    = b.pc;
+                n.pTaken  = b.pTaken;
+                n.pTarget = b.pTarget;
+                ifq_.pop_front();
+                st_.fused++;
+            } else {
+                n.opPc    = a.pc;
+                n.pTaken  = a.pTaken;
+                n.pTarget = a.pTarget;
+            }
+            ifq_.pop_front();
+            Kind k = n.d[n.fused ? 1 : 0].kind;
+            int64_t lat = (k == Kind::Mul || k == Kind::Div) ? cfg_.mul_lat
+                        : k == Kind::Fpu                     ? cfg_.fpu_lat
+                                                             : 1;
+            n.wait = lat - 1;
+            ex_    = n;
+        }
+        if (flushID) ifq_.clear();
+
+        core_.mip = (core_.mip & ~(MIP_MTIP | MIP_MEIP)) | lines;
+    }
+
+    // ---------------------------------------
+    // EX -> MEM
+    // ---------------------------------------
+    if (memReady) {
+        mem1_ = next;
+    } else if (memDone && mem1_.split) {
+        mem1_.upper = true;
+    }
+
+    // ---------------------------------------
+    // IF (Program_Counter, IFID)
+    // ---------------------------------------
+    bool ifBeat = m0_ == M0_DATA && c >= fetch_.first && c <= fetch_.last
+               && (c - fetch_.first) % fetch_.gap == 0;
+    bool ifDone = (m0_ == M0_ADDR && !ifValid_) || (m0_ == M0_DATA && c == fetch_.last);
+    bool drop   = redirect || pending_;
+    if (ifBeat && !drop)
+        ifq_.push_back({fetchPc_, mem_.read(fetchPc_, 4), pTaken, pTarget});
+    if (ifDone) {
+        fetchPc_  = redirect ? fTarget
+                  : pending_ ? pendingTarget_
+                  : ifBeat   ? (pTaken ? pTarget : fetchPc_ + 4)
+                             : fetchPc_;
+        pending_  = false;
+        ifValidN_ = exReady ? exIfValidN : fetchOff_;
+    } else if (redirect) {
+        pending_       = true;
+        pendingTarget_ = fTarget;
+    } else if (ifBeat && !pending_) {
+        // a taken prediction before the last beat drops the rest
+        if (pTaken) {
+            pending_       = true;
+            pendingTarget_ = pTarget;
+        } else {
+            fetchPc_ += 4;
+        }
+    }
+    if (exReady) fetchOff_ = exIfValidN;
+    if (redirect) fetchHold_ = c + 1 + uint64_t(cfg_.redirect_lat);
+
+    switch (m0_) {
+        case M0_IDLE:
+            m0_ = M0_ADDR;
+            break;
+        case M0_ADDR:
+            if (grantR_[M_IF].active) {
+                fetch_ = grantR_[M_IF];
+                m0_    = M0_DATA;
+            }
+            break;
+        case M0_DATA:
+            if (c == fetch_.last) m0_ = M0_ADDR;
+            break;
+    }
+
+    // ---------------------------------------
+    // Store buffer
+    // ---------------------------------------
+    bool sbWasEmpty = sb_.empty();
+    bool drainDone  = m1_ == M1_WRITE && m1Drain_ && c == m1Burst_.last + 1;
+    if (drainDone) {
+        sb_.pop_front();
+        sbHeadLock_ = false;
+        st_.sbDrains++;
+        if (mergeIdx > 0) mergeIdx--;     // the head never takes a merge while draining
+    } else if (drainCond_) {
+        sbHeadLock_ = true;
+    }
+    if (sbPush) {
+        if (mergeIdx < 0) {
+            sb_.push_back({memA / lineBytes, std::vector<uint8_t>(size_t(cfg_.sb_line_words), 0)});
+            mergeIdx = int(sb_.size()) - 1;
+        }
+        sb_[size_t(mergeIdx)].strb[(memA % lineBytes) >> 2] |= pushStrb;
+    }
+    if (drainDone || sbWasEmpty || drainReq_) sbAge_ = 0;
+    else if (sbAge_ != unsigned(cfg_.sb_drain_age)) sbAge_++;
+
+    // ---------------------------------------
+    // M1
+    // ---------------------------------------
+    switch (m1_) {
+        case M1_IDLE:
+            m1_ = M1_ADDR;
+            break;
+        case M1_ADDR:
+            if (grantR_[M_MEM].active) {
+                m1Burst_ = grantR_[M_MEM];
+                m1Drain_ = false;
+                m1_      = M1_READ;
+            } else if (grantW_[M_MEM].active) {
+                m1Burst_ = grantW_[M_MEM];
+                m1Drain_ = drainGo_;
+                m1_      = M1_WRITE;
+            }
+            break;
+        case M1_READ:
+            if (c == m1Burst_.last) m1_ = M1_ADDR;
+            break;
+        case M1_WRITE:
+            if (c == m1Burst_.last + 1) m1_ = M1_ADDR;
+            break;
+    }
+    awHold_ = reqW_[M_MEM].valid && !grantW_[M_MEM].active && drainGo_;
+}
+
+// ============================================================
+// DMA
+// ------------------------------------------------------------
+// DMA_wrapper M2 FSM around DMA.sv. AR and AW of a burst are
+// each held until accepted; data then moves in lockstep (RREADY
+// follows WREADY), so beat k completes when both slaves can
+// take it. The words are copied when the burst completes.
+// ============================================================
+void Soc::dmaFirstBurst() {
+    uint32_t burst     = uint32_t(cfg_.dma_burst);
+    uint32_t lineBytes = burst * 4;
+    if (dmaLen_ < burst) {
+        dmaBeats_ = dmaLen_ ? dmaLen_ : burst;
+        dmaLen_   = 0;
+    } else if (dmaSrc_ % lineBytes) {
+        dmaBeats_ = (lineBytes - dmaSrc_ % lineBytes) >> 2;
+        dmaLen_  -= dmaBeats_;
+    } else {
+        dmaBeats_ = burst;
+        dmaLen_  -= burst;
+    }
+}
+
+void Soc::stepDma(uint64_t c) {
+    uint32_t burst     = uint32_t(cfg_.dma_burst);
+    uint32_t lineBytes = burst * 4;
+
+    switch (dma_) {
+        case DMA_IDLE:
+            if (dmaStart_) dma_ = DMA_DESC_AR;
+            break;
+        case DMA_DESC_AR:
+            if (grantR_[M_DMA].active) {
+                dmaRd_ = grantR_[M_DMA];
+                dma_   = DMA_DESC_DATA;
+            }
+            break;
+        case DMA_DESC_DATA:
+            if (c == dmaRd_.last) {
+                dmaSrc_  = mem_.read(dmaDesc_,      4);
+                dmaDst_  = mem_.read(dmaDesc_ + 4,  4);
+                dmaLen_  = mem_.read(dmaDesc_ + 8,  4);
+                dmaNext_ = mem_.read(dmaDesc_ + 12, 4);
+                dmaEoc_  = mem_.read(dmaDesc_ + 16, 4) & 1;
+                dmaFirstBurst();
+                dmaArDone_ = dmaAwDone_ = false;
+                dma_       = DMA_XFER_AR;
+            }
+            break;
+        case DMA_XFER_AR:
+            if (grantR_[M_DMA].active) {
+                dmaRd_     = grantR_[M_DMA];
+                dmaArDone_ = true;
+            }
+            if (grantW_[M_DMA].active) {
+                dmaWr_     = grantW_[M_DMA];
+                dmaAwDone_ = true;
+            }
+            if (dmaArDone_ && dmaAwDone_) {
+                uint64_t hs = std::max({c + 1, dmaRd_.first, dmaWr_.first});
+                hs += uint64_t(dmaBeats_ - 1) * std::max(dmaRd_.gap, dmaWr_.gap);
+                dmaLast_ = hs;
+                freeAt_[dmaRd_.slave] = hs + 1;
+                freeAt_[dmaWr_.slave] = hs + 2;
+                dma_ = DMA_XFER_DATA;
+            }
+            break;
+        case DMA_XFER_DATA:
+            if (c != dmaLast_) break;
+            for (unsigned k = 0; k < dmaBeats_; k++)
+                mem_.write(dmaDst_ + 4 * k, mem_.read(dmaSrc_ + 4 * k, 4), 4);
+            if (dmaLen_ == 0) {
+                dmaDesc_ = dmaNext_;
+                dmaIrq_  = dmaEoc_;
+                dma_     = dmaEoc_ ? DMA_IDLE : DMA_DESC_AR;
+                break;
+            }
+            dmaSrc_    = dmaSrc_ / lineBytes * lineBytes + lineBytes;
+            dmaDst_    = dmaDst_ / lineBytes * lineBytes + lineBytes;
+            dmaBeats_  = std::min(dmaLen_, burst);
+            dmaLen_   -= dmaBeats_;
+            dmaArDone_ = dmaAwDone_ = false;
+            dma_       = DMA_XFER_AR;
+            break;
+    }
+    dmaStart_ = false;
+}
+
+// ============================================================
+// WDT
+// ------------------------------------------------------------
+// Runs on clk2 edges. One FIFO entry is applied per edge; the
+// timeout passes a detect flop and a two-stage synchronizer
+// before it reaches the CPU.
+// ============================================================
+void Soc::stepWdt(uint64_t c) {
+    uint64_t ratio = uint64_t(cfg_.wdt_ratio);
+    if (c % ratio) return;
+
+    WdtWrite w{0, 0, 0};
+    if (!wdtFifo_.empty() && wdtFifo_.front().edge <= c / ratio) {
+        w = wdtFifo_.front();
+        wdtFifo_.pop_front();
+    }
+
+    bool over = wdtCnt_ > wdtThr_;
+    wdtS2_  = wdtS1_;
+    wdtS1_  = wdtDet_;
+    wdtDet_ = over;
+    if (wdtEn_) {
+        if (over) {
+            if (w.reg == 1 && !(w.value & 1)) wdtCnt_ = 0;
+        } else {
+            wdtCnt_ = wdtLive_ ? 0 : wdtCnt_ + 1;
+        }
+    }
+
+    switch (w.reg) {
+        case 1: wdtEn_   = w.value & 1; break;
+        case 2: wdtLive_ = w.value & 1; break;
+        case 3: wdtThr_  = w.value;     break;
+        default: break;
+    }
+}
@@ -0,0 +1,247 @@
+#pragma once
+// ============================================================
+// Cycle-Approximate SoC Model
+// ------------------------------------------------------------
+// One hart, the AXI interconnect and the slaves of top.sv,
+// stepped one clk cycle at a time. The core executes in EX in
+// program order (Core); everything around it only decides when:
+//
+//   IF   M0 fetch (a burst to the end of the aligned 4-word
+//        block, raised once the queue has room for it), PC /
+//        pending redirect as in Program_Counter, BTB/PHT lookup
+//        per beat, fetch queue of ifq_depth entries
+//   ID   macro-op fusion, load-use bubble
+//   EX   interrupts, WFI, mret, mispredict redirect, predictor
+//        update; M/F ops may hold EX (mul_lat / fpu_lat)
+//   MEM  M1 FSM of CPU_wrapper with the store buffer in front;
+//        misaligned accesses take two transactions
+//
+// Each slave accepts one burst at a time; a grant goes to the
+// highest-numbered requesting master, read before write, as in
+// Arbiter. Beat times come from the wrapper FSMs: SRAM/ROM/
+// devices one beat per cycle after the address cycle, DRAM by
+// row state with the DRAM_wrapper read-ahead streams. DMA runs
+// its descriptor/burst FSM with R and W in lockstep and copies
+// data when a burst completes. The WDT counts on clk2.
+// ============================================================
+#include <cstdint>
+#include <deque>
+#include <vector>
+
+#include "branch_predictor.h"
+#include "config.h"
+#include "core.h"
+#include "elf_loader.h"
+#include "memory.h"
+
+struct RunStats {
+    bool     finished      = false;    // _sim_end reached DM
+    uint64_t cycles        = 0;
+    uint64_t instret       = 0;
+    uint64_t ctrlOps       = 0;        // ops the predictor trains on
+    uint64_t mispredicts   = 0;        // redirects from a wrong prediction
+    uint64_t loadUseStalls = 0;
+    uint64_t fetchBubbles  = 0;        // EX fed a bubble from an empty queue
+    uint64_t memStalls     = 0;        // cycles MEM held the back end
+    uint64_t fused         = 0;
+    uint64_t sbDrains      = 0;
+    uint64_t dramRowHits   = 0;
+    uint64_t dramRowMisses = 0;
+    uint64_t dramStreamHits = 0;
+    uint64_t interrupts    = 0;
+    uint64_t resyncs       = 0;        // model self-check; stays 0
+};
+
+class Soc : private DataPort {
+public:
+    Soc(const Config &cfg, const Memory &image, const ElfImage &elf);
+
+    RunStats run();
+
+    // Words at _test_start that differ from golden
+    unsigned goldenErrors(const std::vector<uint32_t> &golden);
+
+private:
+    // ---------------------------------------
+    // Interconnect
+    // ---------------------------------------
+    enum Master { M_IF = 0, M_MEM, M_DMA, NUM_MASTERS };
+
+    struct Request {
+        bool     valid = false;
+        uint32_t addr  = 0;
+        unsigned beats = 1;
+    };
+
+    // One granted burst; beat k is handshaken at or after first +
+    // k * gap (master always ready unless the DMA lockstep says so)
+    struct Burst {
+        bool     active = false;
+        SlaveId  slave  = S_DEFAULT;
+        bool     write  = false;
+        uint32_t addr   = 0;
+        unsigned beats  = 1;
+        uint64_t first  = 0;
+        unsigned gap    = 1;
+        uint64_t last   = 0;
+    };
+
+    // ---------------------------------------
+    // Pipeline
+    // ---------------------------------------
+    struct FetchEntry {
+        uint32_t pc      = 0;
+        uint32_t inst    = 0;
+        bool     pTaken  = false;
+        uint32_t pTarget = 0;
+    };
+
+    struct ExOp {
+        bool     valid   = false;
+        bool     fused   = false;
+        uint32_t pc      = 0;          // first instruction
+        uint32_t opPc    = 0;          // pc the predictor sees (second when fused)
+        Decoded  d[2];
+        bool     pTaken  = false;
+        uint32_t pTarget = 0;
+        int64_t  wait    = 0;          // extra EX cycles left
+    };
+
+    enum MemKind { MEM_LOAD, MEM_STORE, MEM_FENCE };
+
+    struct MemOp {
+        bool     valid  = false;       // MEM_VALID
+        MemKind  kind   = MEM_LOAD;
+        uint32_t addr   = 0;           // byte address (aluOut)
+        unsigned size   = 4;
+        bool     split  = false;
+        bool     upper  = false;
+        uint32_t data   = 0;           // device store value
+    };
+
+    // ---------------------------------------
+    // Store buffer (byte masks only; data is
+    // already in memory from EX)
+    // ---------------------------------------
+    struct SbEntry {
+        uint32_t             tag = 0;
+        std::vector<uint8_t> strb;
+    };
+
+    // ---------------------------------------
+    // DRAM read-ahead stream
+    // ---------------------------------------
+    struct Stream {
+        bool     valid = false;
+        bool     armed = false;
+        uint32_t id    = 0;            // slave-side ARID (master << 4)
+        uint32_t next  = 0;            // word address
+        unsigned cnt   = 0;
+        bool     hit   = false;        // last AR was served from the buffer
+        unsigned len   = 0;            // beats of the last AR
+    };
+
+    // ---------------------------------------
+    // DMA (DMA_wrapper master side + DMA.sv)
+    // ---------------------------------------
+    enum DmaState { DMA_IDLE, DMA_DESC_AR, DMA_DESC_DATA, DMA_XFER_AR, DMA_XFER_DATA };
+
+    struct WdtWrite {
+        uint64_t edge;                 // clk2 edge it lands on
+        unsigned reg;                  // 1 WDEN, 2 WDLIVE, 3 WTOCNT
+        uint32_t value;
+    };
+
+    // DataPort (functional accesses from EX)
+    uint32_t load(uint32_t addr, unsigned size) override;
+    void     store(uint32_t addr, uint32_t data, unsigned size) override;
+
+    // Per-cycle steps
+    void    postRequests(uint64_t c);
+    void    arbitrate(uint64_t c);
+    Burst   accept(SlaveId s, int master, bool write, uint32_t addr, unsigned beats, uint64_t t);
+    void    dramPrefetch(uint64_t c);
+    void    stepPipeline(uint64_t c);
+    void    stepDma(uint64_t c);
+    void    stepWdt(uint64_t c);
+    void    deviceWrite(uint32_t addr, uint32_t data, uint64_t c);
+
+    // Helpers
+    bool    sbLookup(uint32_t addr, bool &hit) const;
+    int     sbMergeIdx(uint32_t tag, bool drainReq) const;
+    bool    sbDrainCond(bool force) const;
+    void    sbDrainBurst(uint32_t &addr, unsigned &beats) const;
+    bool    fusable(const FetchEntry &a, const FetchEntry &b) const;
+    bool    loadUse(const ExOp &ex, const FetchEntry &id) const;
+    void    dmaFirstBurst();
+    bool    simEndVisible();
+
+    const Config    &cfg_;
+    Memory           mem_;
+    Core             core_;
+    BranchPredictor  bp_;
+    uint32_t         simEnd_, testStart_;
+    RunStats         st_;
+
+    // Interconnect
+    Request  reqR_[NUM_MASTERS], reqW_[NUM_MASTERS];
+    Burst    grantR_[NUM_MASTERS], grantW_[NUM_MASTERS];
+    uint64_t freeAt_[NUM_SLAVES] = {};
+    bool     dramGranted_ = false;
+
+    // DRAM
+    bool                dramRowOpen_ = false;
+    uint32_t            dramRow_     = 0;
+    std::vector<Stream> streams_;
+    unsigned            streamVictim_ = 0;
+    int                 pfStream_     = -1;
+    uint64_t            pfDone_       = 0;
+
+    // IF
+    enum M0State { M0_IDLE, M0_ADDR, M0_DATA } m0_ = M0_IDLE;
+    Burst                  fetch_;
+    uint32_t               fetchPc_ = 0;
+    bool                   pending_ = false;
+    uint32_t               pendingTarget_ = 0;
+    bool                   ifValidN_ = false, fetchOff_ = false;
+    uint64_t               fetchHold_ = 0;
+    std::deque<FetchEntry> ifq_;
+
+    // EX / MEM
+    ExOp  ex_;
+    MemOp mem1_;
+    enum M1State { M1_IDLE, M1_ADDR, M1_READ, M1_WRITE } m1_ = M1_IDLE;
+    Burst m1Burst_;
+    bool  m1Drain_ = false;
+    bool  awHold_  = false;
+    bool  ifValid_ = false;             // IF_VALID this cycle
+    bool  loadGo_ = false, directGo_ = false, drainGo_ = false;
+    bool  drainCond_ = false, drainReq_ = false;
+    uint32_t storeDevData_ = 0;         // device store captured by store()
+
+    // Store buffer
+    std::deque<SbEntry> sb_;
+    bool     sbHeadLock_ = false;
+    unsigned sbAge_      = 0;
+
+    // DMA
+    DmaState dma_ = DMA_IDLE;
+    bool     dmaStart_ = false;
+    uint32_t dmaDesc_ = 0, dmaSrc_ = 0, dmaDst_ = 0, dmaLen_ = 0, dmaNext_ = 0;
+    bool     dmaEoc_ = false, dmaIrq_ = false;
+    unsigned dmaBeats_ = 0;
+    bool     dmaArDone_ = false, dmaAwDone_ = false;
+    Burst    dmaRd_, dmaWr_;
+    uint64_t dmaLast_ = 0;
+
+    // WDT (clk2 domain)
+    std::deque<WdtWrite> wdtFifo_;
+    bool     wdtEn_ = false, wdtLive_ = false;
+    uint32_t wdtThr_ = 0, wdtCnt_ = 0;
+    bool     wdtDet_ = false, wdtS1_ = false, wdtS2_ = false;
+
+    // PIX / HSEM registers
+    std::vector<uint32_t> pixRegs_;
+    uint32_t hsemLock_[16] = {}, hsemMbox_[4] = {};
+    bool     hsemFull_[4] = {};
+};
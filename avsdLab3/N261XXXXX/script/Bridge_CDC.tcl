@@ -0,0 +1,25 @@
+#spyglass shell source tcl code
+#In the Spyglass shell type "source ../script/Bridge_CDC.tcl" to execute script
+
+#import design
+read_file -type sgdc ../script/Bridge_CDC.sgdc
+read_file -type verilog ../src/CDC_lib/AXI_CDC_Bridge.sv
+set_option enableSV yes
+set_option incdir {../include ../src ../src/CDC_lib }
+
+#read design
+current_goal Design_Read -alltop
+link_design -force
+
+#start CDC verification
+current_goal cdc/cdc_setup_check -alltop
+run_goal
+
+current_goal cdc/clock_reset_integrity -alltop
+run_goal
+
+current_goal cdc/cdc_verify_struct -alltop
+run_goal
+
+current_goal cdc/cdc_verify -alltop
+run_goal
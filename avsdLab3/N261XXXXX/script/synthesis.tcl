@@ -1,6 +1,24 @@
 #   Read in top module
 #read_file -autoread -top CHIP {../src/ ../include}
-read_file -format sverilog {../src/top.sv}
+#   make synthesize DEEP=1 builds the deeper-pipeline CPU (CPU_DEEP)
+#   make synthesize DUAL=1 builds the two-hart cluster (DUAL_CORE)
+#   make synthesize ASYNC=1 puts DRAM on clk3 behind the CDC bridge (DRAM_ASYNC)
+set top_defines {}
+if {[info exists env(CPU_DEEP)] && $env(CPU_DEEP) == 1} {
+    lappend top_defines CPU_DEEP
+}
+if {[info exists env(DUAL_CORE)] && $env(DUAL_CORE) == 1} {
+    lappend top_defines DUAL_CORE
+}
+if {[info exists env(DRAM_ASYNC)] && $env(DRAM_ASYNC) == 1} {
+    lappend top_defines DRAM_ASYNC
+}
+if {[llength $top_defines] > 0} {
+    analyze -format sverilog -define $top_defines {../src/top.sv}
+    elaborate top
+} else {
+    read_file -format sverilog {../src/top.sv}
+}
 
 # SET POWER INTENT and ENVIRONMENT ###################################
 current_design top
@@ -0,0 +1,53 @@
+#include <stdint.h>
+
+// Macro-op fusion test (see fuse.S)
+//   phase 1: lui+addi, auipc+jalr, slli+add, slt+bnez/beqz
+//   phase 2: WDT interrupts taken while a loop of fused pairs
+//            runs; each pair is torn down at the end of the loop
+//            so resuming at the second half shows up as an error
+// golden.hex was worked out by hand and has not been checked
+// against a simulation yet.
+
+#define MIP_MEIP (1 << 11) // External interrupt pending
+#define MIP_MTIP (1 << 7)  // Timer interrupt pending
+#define MIP 0x344
+
+volatile unsigned int *WDT_addr = (int *) 0x10010000;
+volatile unsigned int *dma_en   = (unsigned int *) 0x10020100; // DMAEN
+
+void fuse_test(volatile unsigned int *test);
+
+// ------------------------------------------------------------
+// Direct mode (boot): trap_entry -> trap_handler
+// ------------------------------------------------------------
+void timer_interrupt_handler(void) {
+  asm("csrsi mstatus, 0x0"); // MIE of mstatus
+  WDT_addr[0x40] = 0; // WDT_en
+}
+
+void external_interrupt_handler(void) {
+  asm("csrsi mstatus, 0x0"); // MIE of mstatus
+  *dma_en = 0; // disable DMA
+}
+
+void trap_handler(void) {
+    uint32_t mip;
+
+    asm volatile("csrr %0, %1" : "=r"(mip) : "i"(MIP));
+
+    if ((mip & MIP_MTIP) >> 7) {
+        timer_interrupt_handler();
+    }
+
+    if ((mip & MIP_MEIP) >> 11) {
+        external_interrupt_handler();
+    }
+}
+
+int main(void) {
+  extern unsigned int _test_start;
+
+  fuse_test(&_test_start);
+
+  return 0;
+}
@@ -0,0 +1,36 @@
+#include <stdint.h>
+
+#define MIP_MEIP (1 << 11) // External interrupt pending
+#define MIP_MTIP (1 << 7)  // Timer interrupt pending
+#define MIP 0x344
+
+volatile unsigned int *WDT_addr = (int *) 0x10010000;
+volatile unsigned int *dma_addr_boot = (int *) 0x10020000;
+
+
+
+
+void timer_interrupt_handler(void) {
+  asm("csrsi mstatus, 0x0"); // MIE of mstatus
+  WDT_addr[0x40] = 0; // WDT_en
+  asm("j _start");
+}
+
+void external_interrupt_handler(void) {
+	volatile unsigned int *dma_addr_boot = (int *) 0x10020000;
+	asm("csrsi mstatus, 0x0"); // MIE of mstatus
+	dma_addr_boot[0x40] = 0; // disable DMA
+}
+
+void trap_handler(void) {
+    uint32_t mip;
+    asm volatile("csrr %0, %1" : "=r"(mip) : "i"(MIP));
+	
+    if ((mip & MIP_MTIP) >> 7) {
+        timer_interrupt_handler();
+    }
+
+    if ((mip & MIP_MEIP) >> 11) {
+        external_interrupt_handler();
+    }
+}
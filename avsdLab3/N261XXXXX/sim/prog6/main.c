@@ -0,0 +1,95 @@
+#include <stdint.h>
+
+// AXI async bridge throughput test (DRAM in its own clock domain)
+//   phase 1: CPU write stream   -> src[0..N)
+//   phase 2: DMA DRAM-to-DRAM   src -> dst (16-beat bursts both ways)
+//   phase 3: CPU read stream    dst, checksum and compare
+#define N     256          // words per buffer
+#define SEED  0x12345678
+#define STEP  0x9E3779B1
+
+#define MIP_MEIP (1 << 11) // External interrupt pending
+#define MIP_MTIP (1 << 7)  // Timer interrupt pending
+#define MIP 0x344
+
+volatile unsigned int *dma_en   = (unsigned int *) 0x10020100; // DMAEN
+volatile unsigned int *dma_desc = (unsigned int *) 0x10020200; // DMA descriptor base
+
+typedef struct {
+  unsigned int DMASRC;
+  unsigned int DMADST;
+  unsigned int DMALEN;
+  unsigned int NEXT_DESC;
+  unsigned int EOC;
+} DMA_DESC;
+
+void timer_interrupt_handler(void) {
+  asm("csrsi mstatus, 0x0"); // MIE of mstatus
+}
+
+void external_interrupt_handler(void) {
+  asm("csrsi mstatus, 0x0"); // MIE of mstatus
+  *dma_en = 0; // disable DMA
+}
+
+void trap_handler(void) {
+    uint32_t mip;
+
+    asm volatile("csrr %0, %1" : "=r"(mip) : "i"(MIP));
+
+    if ((mip & MIP_MTIP) >> 7) {
+        timer_interrupt_handler();
+    }
+
+    if ((mip & MIP_MEIP) >> 11) {
+        external_interrupt_handler();
+    }
+}
+
+int main(void) {
+  extern unsigned int _test_start;
+  volatile unsigned int *test = &_test_start;
+  unsigned int *src = &_test_start + N;
+  unsigned int *dst = &_test_start + 2 * N;
+  volatile DMA_DESC *desc = (DMA_DESC *)0x0002FF00;
+  unsigned int p, v, sum, err;
+  int i;
+
+  // -------- Phase 1: CPU write stream --------
+  p = SEED;
+  for (i = 0; i < N; i++) {
+    src[i] = p;
+    p += STEP;
+  }
+
+  // -------- Phase 2: DMA copy across the bridge --------
+  desc->DMASRC    = (unsigned int)src;
+  desc->DMADST    = (unsigned int)dst;
+  desc->DMALEN    = N;
+  desc->NEXT_DESC = 0x0;
+  desc->EOC       = 1;
+
+  asm("csrsi mstatus, 0x8"); // MIE of mstatus
+  asm("li t6, 0x800");
+  asm("csrs mie, t6");       // MEIE of mie
+
+  *dma_desc = (unsigned int)desc;
+  *dma_en   = 1;
+  asm("wfi");
+
+  // -------- Phase 3: CPU read stream --------
+  p   = SEED;
+  sum = 0;
+  err = 0;
+  for (i = 0; i < N; i++) {
+    v    = dst[i];
+    sum += v ^ i;
+    if (v != p) err++;
+    p   += STEP;
+  }
+
+  test[0] = sum;
+  test[1] = err;
+
+  return 0;
+}
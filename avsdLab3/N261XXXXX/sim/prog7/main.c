@@ -0,0 +1,138 @@
+#include <stdint.h>
+
+// Vectored interrupt test
+//   phase 1: mtvec MODE = vectored, read back
+//   phase 2: DMA done      -> mei_handler (mcause 11)
+//   phase 3: WDT timeout   -> mti_handler (mcause 7)
+//   phase 4: DMA and WDT armed together; the second handler is
+//            entered by tail-chaining from the first one's mret
+#define N 16
+
+#define MIP_MEIP (1 << 11) // External interrupt pending
+#define MIP_MTIP (1 << 7)  // Timer interrupt pending
+#define MIP 0x344
+
+volatile unsigned int *WDT_addr = (int *) 0x10010000;
+volatile unsigned int *dma_en   = (unsigned int *) 0x10020100; // DMAEN
+volatile unsigned int *dma_desc = (unsigned int *) 0x10020200; // DMA descriptor base
+
+typedef struct {
+  unsigned int DMASRC;
+  unsigned int DMADST;
+  unsigned int DMALEN;
+  unsigned int NEXT_DESC;
+  unsigned int EOC;
+} DMA_DESC;
+
+volatile unsigned int mei_cause, mti_cause;
+volatile unsigned int mei_count, mti_count;
+unsigned int src[N] __attribute__((aligned(64)));
+
+// ------------------------------------------------------------
+// Direct mode (boot): trap_entry -> trap_handler
+// ------------------------------------------------------------
+void timer_interrupt_handler(void) {
+  asm("csrsi mstatus, 0x0"); // MIE of mstatus
+  WDT_addr[0x40] = 0; // WDT_en
+}
+
+void external_interrupt_handler(void) {
+  asm("csrsi mstatus, 0x0"); // MIE of mstatus
+  *dma_en = 0; // disable DMA
+}
+
+void trap_handler(void) {
+    uint32_t mip;
+
+    asm volatile("csrr %0, %1" : "=r"(mip) : "i"(MIP));
+
+    if ((mip & MIP_MTIP) >> 7) {
+        timer_interrupt_handler();
+    }
+
+    if ((mip & MIP_MEIP) >> 11) {
+        external_interrupt_handler();
+    }
+}
+
+// ------------------------------------------------------------
+// Vectored mode: entered straight from the vector table, the
+// handler only saves what it uses and returns with mret.
+// The source is cleared and mip re-checked before returning so
+// a level that has not dropped yet is not taken twice.
+// ------------------------------------------------------------
+void __attribute__((interrupt("machine"))) mei_handler(void) {
+  uint32_t cause, mip;
+
+  asm volatile("csrr %0, mcause" : "=r"(cause));
+  *dma_en = 0; // disable DMA
+  mei_cause = cause;
+  mei_count++;
+  do {
+    asm volatile("csrr %0, %1" : "=r"(mip) : "i"(MIP));
+  } while (mip & MIP_MEIP);
+}
+
+void __attribute__((interrupt("machine"))) mti_handler(void) {
+  uint32_t cause, mip;
+
+  asm volatile("csrr %0, mcause" : "=r"(cause));
+  WDT_addr[0x40] = 0; // WDT_en
+  mti_cause = cause;
+  mti_count++;
+  do {
+    asm volatile("csrr %0, %1" : "=r"(mip) : "i"(MIP));
+  } while (mip & MIP_MTIP);
+}
+
+void dma_start(volatile DMA_DESC *desc) {
+  *dma_desc = (unsigned int)desc;
+  *dma_en   = 1;
+}
+
+int main(void) {
+  extern unsigned int _test_start;
+  volatile unsigned int *test = &_test_start;
+  volatile DMA_DESC *desc = (DMA_DESC *)0x0002FF00;
+  uint32_t mtvec;
+  int i;
+
+  for (i = 0; i < N; i++)
+    src[i] = 0xA5000000 | i;
+
+  desc->DMASRC    = (unsigned int)src;
+  desc->DMADST    = (unsigned int)(&_test_start + 16);
+  desc->DMALEN    = N;
+  desc->NEXT_DESC = 0x0;
+  desc->EOC       = 1;
+
+  // -------- Phase 1: vectored mode --------
+  asm("csrsi mtvec, 0x1");
+  asm volatile("csrr %0, mtvec" : "=r"(mtvec));
+  test[0] = mtvec;
+
+  asm("li t6, 0x880");
+  asm("csrs mie, t6");       // MEIE | MTIE of mie
+  asm("csrsi mstatus, 0x8"); // MIE of mstatus
+
+  // -------- Phase 2: DMA only --------
+  dma_start(desc);
+  while (mei_count < 1);
+
+  // -------- Phase 3: WDT only --------
+  WDT_addr[0xc0] = 10; // tonet
+  WDT_addr[0x40] = 1;  // WDT_en
+  while (mti_count < 1);
+
+  // -------- Phase 4: back-to-back --------
+  WDT_addr[0x40] = 1;  // WDT_en
+  dma_start(desc);
+  while (mei_count < 2 || mti_count < 2);
+
+  test[1] = mei_cause;
+  test[2] = mti_cause;
+  test[3] = mei_count;
+  test[4] = mti_count;
+
+  return 0;
+}
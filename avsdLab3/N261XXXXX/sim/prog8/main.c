@@ -0,0 +1,141 @@
+#include <stdint.h>
+
+// Pixel accelerator test: prog2's BGR -> gray conversion with the
+// pixel data streamed through the accelerator by DMA.
+//   CPU: BMP header and the pixels outside the word-aligned
+//        4-pixel (3-word) groups at both ends
+//   DMA: chained descriptors alternate IN chunk -> OUT chunk, so
+//        the output FIFO never fills while the DMA is still writing
+#define CHUNK 48             // words per IN/OUT pair: multiple of 3, <= OUT FIFO depth
+#define MAX_DESC 256
+
+#define PIX_CTRL   0
+#define PIX_WEIGHT 1
+#define PIX_DIV    2
+#define PIX_STATUS 5
+#define PIX_IN     0x10031000
+#define PIX_OUT    0x10032000
+
+#define CTRL_EN    (1 << 0)
+#define CTRL_WHITE (1 << 2)
+
+#define MIP_MEIP (1 << 11) // External interrupt pending
+#define MIP_MTIP (1 << 7)  // Timer interrupt pending
+#define MIP 0x344
+
+volatile unsigned int *dma_en   = (unsigned int *) 0x10020100; // DMAEN
+volatile unsigned int *dma_desc = (unsigned int *) 0x10020200; // DMA descriptor base
+volatile unsigned int *pix      = (unsigned int *) 0x10030000; // PIX registers
+
+typedef struct {
+  unsigned int DMASRC;
+  unsigned int DMADST;
+  unsigned int DMALEN;
+  unsigned int NEXT_DESC;
+  unsigned int EOC;
+} DMA_DESC;
+
+DMA_DESC desc[MAX_DESC];
+
+void timer_interrupt_handler(void) {
+  asm("csrsi mstatus, 0x0"); // MIE of mstatus
+}
+
+void external_interrupt_handler(void) {
+  asm("csrsi mstatus, 0x0"); // MIE of mstatus
+  *dma_en = 0; // disable DMA
+}
+
+void trap_handler(void) {
+    uint32_t mip;
+
+    asm volatile("csrr %0, %1" : "=r"(mip) : "i"(MIP));
+
+    if ((mip & MIP_MTIP) >> 7) {
+        timer_interrupt_handler();
+    }
+
+    if ((mip & MIP_MEIP) >> 11) {
+        external_interrupt_handler();
+    }
+}
+
+static void gray_pixel(unsigned char *in, unsigned char *out) {
+  unsigned char gray;
+  if ((in[0] == 0xff) && (in[1] == 0xff) && (in[2] == 0xff))
+    gray = 0xff;
+  else
+    gray = ((in[0] * 11) + (in[1] * 59) + (in[2] * 30)) / 100;
+  out[0] = gray;
+  out[1] = gray;
+  out[2] = gray;
+}
+
+int main(void) {
+  extern unsigned char _binary_image_bmp_start;
+  extern unsigned char _test_start;
+  unsigned char *bmp = &_binary_image_bmp_start;
+  unsigned char *out = &_test_start;
+  unsigned int size, head, tail, words, len, src, dst, n, i;
+
+  size = (bmp[5] << 24) + (bmp[4] << 16) + (bmp[3] << 8) + bmp[2];
+
+  for (i = 0; i < 54; i++)
+    out[i] = bmp[i];
+
+  // -------- Split: CPU edges, accelerator body --------
+  for (head = 54; head < size; head += 3)
+    if (((((unsigned int)(bmp + head)) | ((unsigned int)(out + head))) & 3) == 0)
+      break;
+  words = (head < size) ? ((size - head) / 12) * 3 : 0;
+  tail  = head + words * 4;
+
+  for (i = 54; i < head && i < size; i += 3)
+    gray_pixel(bmp + i, out + i);
+  for (i = tail; i < size; i += 3)
+    gray_pixel(bmp + i, out + i);
+
+  if (words == 0)
+    return 0;
+
+  // -------- Accelerator: prog2 weights, BMP output layout --------
+  pix[PIX_CTRL]   = 0;                                   // clear stream state
+  pix[PIX_WEIGHT] = (30 << 16) | (59 << 8) | 11;         // {R, G, B}
+  pix[PIX_DIV]    = 100;
+  while (pix[PIX_STATUS] & 1);                           // reciprocal ready
+  pix[PIX_CTRL]   = CTRL_EN | CTRL_WHITE;
+
+  // -------- DMA chain: IN chunk, OUT chunk, ... --------
+  n = 0;
+  for (i = 0; i < words; i += len) {
+    len = (words - i < CHUNK) ? words - i : CHUNK;
+    src = (unsigned int)(bmp + head) + 4 * i;
+    dst = (unsigned int)(out + head) + 4 * i;
+
+    desc[n].DMASRC    = src;
+    desc[n].DMADST    = PIX_IN + (src & 63);   // same 64-byte offset as src
+    desc[n].DMALEN    = len;
+    desc[n].NEXT_DESC = (unsigned int)&desc[n + 1];
+    desc[n].EOC       = 0;
+    n++;
+
+    desc[n].DMASRC    = PIX_OUT + (dst & 63);  // same 64-byte offset as dst
+    desc[n].DMADST    = dst;
+    desc[n].DMALEN    = len;
+    desc[n].NEXT_DESC = (unsigned int)&desc[n + 1];
+    desc[n].EOC       = 0;
+    n++;
+  }
+  desc[n - 1].NEXT_DESC = 0x0;
+  desc[n - 1].EOC       = 1;
+
+  asm("csrsi mstatus, 0x8"); // MIE of mstatus
+  asm("li t6, 0x800");
+  asm("csrs mie, t6");       // MEIE of mie
+
+  *dma_desc = (unsigned int)desc;
+  *dma_en   = 1;
+  asm("wfi");
+
+  return 0;
+}
@@ -0,0 +1,101 @@
+#include <stdint.h>
+
+#define MIP_MEIP (1 << 11) // External interrupt pending
+#define MIP_MTIP (1 << 7)  // Timer interrupt pending
+#define MIP 0x344
+
+volatile unsigned int *WDT_addr = (int *) 0x10010000;
+volatile unsigned int *dma_addr_boot = (int *) 0x10020000;
+
+// Hardware semaphore / mailbox (word index)
+volatile unsigned int *hsem = (unsigned int *) 0x10040000;
+#define LOCK0    0x00
+#define MBOX0    0x40
+#define MSTAT0   0x80
+
+#define ROWS     64
+#define ROW_SIZE (64 * 3)
+
+volatile unsigned int rows_done = 0;
+
+
+
+
+void timer_interrupt_handler(void) {
+  asm("csrsi mstatus, 0x0"); // MIE of mstatus
+  WDT_addr[0x40] = 0; // WDT_en
+  asm("j _start");
+}
+
+void external_interrupt_handler(void) {
+	volatile unsigned int *dma_addr_boot = (int *) 0x10020000;
+	asm("csrsi mstatus, 0x0"); // MIE of mstatus
+	dma_addr_boot[0x40] = 0; // disable DMA
+} 
+
+void trap_handler(void) {
+    uint32_t mip;
+    asm volatile("csrr %0, %1" : "=r"(mip) : "i"(MIP));
+	
+    if ((mip & MIP_MTIP) >> 7) {
+        timer_interrupt_handler();
+    }
+
+    if ((mip & MIP_MEIP) >> 11) {
+        external_interrupt_handler();
+    }
+}
+
+static void convert_row(unsigned char *src, unsigned char *dst, int row) {
+	int start = 54 + row * ROW_SIZE;
+	for (int i = start; i < start + ROW_SIZE; i+=3) {
+		unsigned char gray;
+		if ((src[i] == 0xff) && (src[i + 1] == 0xff) && (src[i + 2] == 0xff))
+			gray = 0xff;
+		else {
+			unsigned char blue = src[i];
+			unsigned char green = src[i + 1];
+			unsigned char red = src[i + 2];
+			gray = ((blue * 11) + (green * 59) + (red * 30)) / 100;
+		}
+		dst[i] = gray;
+		dst[i + 1] = gray;
+		dst[i + 2] = gray;
+	}
+}
+
+int main(void) {
+	extern unsigned char _binary_image_bmp_start;
+	extern unsigned char _test_start;
+	unsigned char *src = &_binary_image_bmp_start;
+	unsigned char *dst = &_test_start;
+	unsigned int hartid;
+
+	asm volatile("csrr %0, mhartid" : "=r"(hartid));
+
+	// hart 0 takes the header and the first half of the image, hart 1 the rest
+	if (hartid == 0)
+		for (int i = 0; i < 54; i++)
+			dst[i] = src[i];
+
+	for (int row = hartid * (ROWS / 2); row < (hartid + 1) * (ROWS / 2); row++) {
+		convert_row(src, dst, row);
+
+		while (hsem[LOCK0]);	// test-and-set
+		rows_done++;
+		hsem[LOCK0] = 0;
+	}
+
+	if (hartid != 0) {
+		hsem[MBOX0] = hartid;	// tell hart 0 we are done
+		return 0;
+	}
+
+	while (!hsem[MSTAT0]);
+	unsigned int peer = hsem[MBOX0];
+
+	*((volatile unsigned int *)(dst + 12344)) = rows_done;
+	*((volatile unsigned int *)(dst + 12348)) = peer;
+
+	return 0;
+}
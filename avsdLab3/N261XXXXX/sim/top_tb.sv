@@ -26,6 +26,7 @@
 `define SIM_END 'h3fff
 `define SIM_END_CODE -32'd1
 `define TEST_START 'h40000
+`define CPU0 TOP.CPU_wrapper.CPU
 module top_tb;
 
   logic clk;
@@ -57,8 +58,40 @@ module top_tb;
   logic [31:0] temp;
   integer err;
   string prog_path;
+  `ifndef SYN
+  // checkpoint / restore
+  logic ckpt_save, ckpt_load;
+  logic [31:0] ckpt_pc;
+  logic [31:0] ckpt_state[0:10];
+  string ckpt_dir;
+  logic ckpt_mem_v, ckpt_wb_v;
+  // issue statistics (macro-op fusion)
+  integer fused_cnt = 0;
+  `endif
   always #(`CYCLE/2) clk = ~clk;
   always #(`CYCLE2/2) clk2 = ~clk2;
+  `ifndef SYN
+  always @(posedge clk)
+    if (`CPU0.EX_retire && `CPU0.EX_fused) fused_cnt <= fused_cnt + 1;
+
+  // MEM / WB occupancy for the checkpoint drain: EX-MEM and MEM-WB
+  // move on MEM_ready and take a bubble unless an op retires in EX
+  always @(posedge clk or posedge rst)
+    if (rst)
+    begin
+      ckpt_mem_v <= 1'b0;
+      ckpt_wb_v  <= 1'b0;
+    end
+    else if (`CPU0.MEM_ready)
+    begin
+      ckpt_mem_v <= `CPU0.EX_retire;
+      ckpt_wb_v  <= ckpt_mem_v;
+    end
+
+  // a fused op carries the second pc; a trap on it must resume at the first
+  fused_mepc_check : assert property (@(posedge clk) disable iff(rst) ((`CPU0.EX_interrupt_taken && `CPU0.EX_fused) |-> (`CPU0.EX_mepc == `CPU0.EX_pc - 32'd4)))
+  else $error("\n *** Interrupt on fused op at %h saved mepc %h ***\n", `CPU0.EX_pc, `CPU0.EX_mepc);
+  `endif
  
   top TOP(
     .clk		  (clk),
@@ -106,6 +139,11 @@ module top_tb;
   initial
   begin
     $value$plusargs("prog_path=%s", prog_path);
+    `ifndef SYN
+    ckpt_save = $test$plusargs("ckpt_save");
+    ckpt_load = $test$plusargs("ckpt_load");
+    if (!$value$plusargs("ckpt_dir=%s", ckpt_dir)) ckpt_dir = {prog_path, "/ckpt"};
+    `endif
     clk = 0; rst = 1; 
 	clk2 = 0; rst2 = 1; 
     #(`CYCLE+`CYCLE2) rst = 0;rst2 = 0;
@@ -117,6 +155,9 @@ module top_tb;
     $readmemh({prog_path, "/dram1.hex"}, i_DRAM.Memory_byte1);
     $readmemh({prog_path, "/dram2.hex"}, i_DRAM.Memory_byte2);
     $readmemh({prog_path, "/dram3.hex"}, i_DRAM.Memory_byte3);
+    `ifndef SYN
+    if (ckpt_load) ckpt_restore();
+    `endif
 
     num = 0;
     gf = $fopen({prog_path, "/golden.hex"}, "r");
@@ -137,6 +178,10 @@ module top_tb;
       
     end	
     $display("\nDone\n");
+    $display("Cycles: %0d", ($time - (`CYCLE+`CYCLE2)) / `CYCLE);
+    `ifndef SYN
+    $display("Instret: %0d  Fused: %0d", `CPU0.CSR_File.instret, fused_cnt);
+    `endif
     err = 0;
 
     for (i = 0; i < num; i++)
@@ -155,6 +200,112 @@ module top_tb;
     $finish;
   end
 
+  `ifndef SYN
+  // ============================================================
+  // Checkpoint / Restore
+  // ------------------------------------------------------------
+  // +ckpt_save +ckpt_pc=<hex>: when the instruction at ckpt_pc
+  // (e.g. main) retires in EX, stop fetch the way WFI does (no
+  // new request once the one in flight completes), let the queue,
+  // back end and store buffer drain, dump the architectural state
+  // to ckpt_dir and go on.
+  // +ckpt_load: start from that dump instead of running boot.
+  // The dump holds x/f registers, CSRs, the next PC and IM/DM/
+  // DRAM; DMA/WDT must be idle at the chosen point (true after
+  // boot, checked at save). Hart 0 only.
+  // ============================================================
+  initial
+  begin
+    wait (rst === 1'b0);
+    if (ckpt_save)
+    begin
+      if (!$value$plusargs("ckpt_pc=%h", ckpt_pc))
+        $fatal(1, "+ckpt_save needs +ckpt_pc=<hex>");
+      @(negedge clk iff `CPU0.EX_retire && `CPU0.EX_pc == ckpt_pc);
+      force `CPU0.EX_IF_VALIDn = 1'b1;
+      force `CPU0.fetchOff     = 1'b1;
+      wait (`CPU0.IF_VALIDn);
+      wait (!`CPU0.ID_valid);
+      wait (!`CPU0.EX_valid && !`CPU0.EX_busy && !ckpt_mem_v && !ckpt_wb_v && !`CPU0.MEM_VALID &&
+            TOP.CPU_wrapper.sb_empty && TOP.CPU_wrapper.CurrentState_M1 == TOP.CPU_wrapper.IDLE_M1);
+      @(negedge clk);
+      if (TOP.DMA_wrapper.CurrentState_M2 != TOP.DMA_wrapper.IDLE)
+        $fatal(1, "Checkpoint at PC %h: DMA is not idle", ckpt_pc);
+      if (TOP.WDT_wrapper.wdt.wdt_enable_state)
+        $fatal(1, "Checkpoint at PC %h: WDT is enabled", ckpt_pc);
+      ckpt_dump();
+      release `CPU0.EX_IF_VALIDn;
+      release `CPU0.fetchOff;
+    end
+  end
+
+  task ckpt_dump;
+    integer sf;
+    begin
+      void'($system({"mkdir -p ", ckpt_dir}));
+      $writememh({ckpt_dir, "/xreg.hex"}, `CPU0.regFile.int_regs);
+      $writememh({ckpt_dir, "/freg.hex"}, `CPU0.regFile.fp_regs);
+      $writememh({ckpt_dir, "/im.hex"}, TOP.IM1.i_SRAM.MEMORY);
+      $writememh({ckpt_dir, "/dm.hex"}, TOP.DM1.i_SRAM.MEMORY);
+      $writememh({ckpt_dir, "/dram0.hex"}, i_DRAM.Memory_byte0);
+      $writememh({ckpt_dir, "/dram1.hex"}, i_DRAM.Memory_byte1);
+      $writememh({ckpt_dir, "/dram2.hex"}, i_DRAM.Memory_byte2);
+      $writememh({ckpt_dir, "/dram3.hex"}, i_DRAM.Memory_byte3);
+      sf = $fopen({ckpt_dir, "/state.hex"}, "w");
+      $fdisplay(sf, "%h", `CPU0.IF_pc);
+      $fdisplay(sf, "%h", `CPU0.CSR_File.mstatus);
+      $fdisplay(sf, "%h", `CPU0.CSR_File.mie);
+      $fdisplay(sf, "%h", `CPU0.CSR_File.mtvec);
+      $fdisplay(sf, "%h", `CPU0.CSR_File.mepc);
+      $fdisplay(sf, "%h", `CPU0.CSR_File.mcause);
+      $fdisplay(sf, "%h", `CPU0.CSR_File.mip);
+      $fdisplay(sf, "%h", `CPU0.CSR_File.cycle[63:32]);
+      $fdisplay(sf, "%h", `CPU0.CSR_File.cycle[31:0]);
+      $fdisplay(sf, "%h", `CPU0.CSR_File.instret[63:32]);
+      $fdisplay(sf, "%h", `CPU0.CSR_File.instret[31:0]);
+      $fclose(sf);
+      $display("Checkpoint saved to %s at PC %h (cycle %0d)", ckpt_dir, `CPU0.IF_pc, `CPU0.CSR_File.cycle);
+    end
+  endtask
+
+  // Runs in the time step rst falls, before the first active edge.
+  task ckpt_restore;
+    begin
+      $readmemh({ckpt_dir, "/state.hex"}, ckpt_state);
+      $readmemh({ckpt_dir, "/xreg.hex"}, `CPU0.regFile.int_regs);
+      $readmemh({ckpt_dir, "/freg.hex"}, `CPU0.regFile.fp_regs);
+      $readmemh({ckpt_dir, "/im.hex"}, TOP.IM1.i_SRAM.MEMORY);
+      $readmemh({ckpt_dir, "/dm.hex"}, TOP.DM1.i_SRAM.MEMORY);
+      $readmemh({ckpt_dir, "/dram0.hex"}, i_DRAM.Memory_byte0);
+      $readmemh({ckpt_dir, "/dram1.hex"}, i_DRAM.Memory_byte1);
+      $readmemh({ckpt_dir, "/dram2.hex"}, i_DRAM.Memory_byte2);
+      $readmemh({ckpt_dir, "/dram3.hex"}, i_DRAM.Memory_byte3);
+      // force + release leaves the value in place until the
+      // registers' own next assignment
+      force `CPU0.pcu.pc               = ckpt_state[0];
+      force `CPU0.CSR_File.mstatus     = ckpt_state[1];
+      force `CPU0.CSR_File.mie         = ckpt_state[2];
+      force `CPU0.CSR_File.mtvec       = ckpt_state[3];
+      force `CPU0.CSR_File.mepc        = ckpt_state[4];
+      force `CPU0.CSR_File.mcause      = ckpt_state[5];
+      force `CPU0.CSR_File.mip         = ckpt_state[6];
+      force `CPU0.CSR_File.cycle       = {ckpt_state[7], ckpt_state[8]};
+      force `CPU0.CSR_File.instret     = {ckpt_state[9], ckpt_state[10]};
+      #0;
+      release `CPU0.pcu.pc;
+      release `CPU0.CSR_File.mstatus;
+      release `CPU0.CSR_File.mie;
+      release `CPU0.CSR_File.mtvec;
+      release `CPU0.CSR_File.mepc;
+      release `CPU0.CSR_File.mcause;
+      release `CPU0.CSR_File.mip;
+      release `CPU0.CSR_File.cycle;
+      release `CPU0.CSR_File.instret;
+      $display("Checkpoint restored from %s at PC %h", ckpt_dir, ckpt_state[0]);
+    end
+  endtask
+  `endif
+
   `ifdef SYN
   initial $sdf_annotate("../syn/top_syn.sdf", TOP);
   `elsif PR
@@ -3,6 +3,9 @@
 `define CYCLE 5.0 // Cycle time
 `define CYCLE2 50.0 // Cycle time for WDT
 `define MAX 3000000 // Max cycle number
+`ifndef CYCLE3
+`define CYCLE3 13.0 // Cycle time for DRAM domain (DRAM_ASYNC)
+`endif
 `ifdef UPF
 import UPF::*;
 `endif
@@ -43,6 +46,8 @@ module top_tb;
   logic clk2;
   logic rst;
   logic rst2;
+  logic clk3;
+  logic rst3;
   logic [31:0] GOLDEN[4096];
   logic [7:0] Memory_byte0[16383:0];
   logic [7:0] Memory_byte1[16383:0];
@@ -65,10 +70,16 @@ module top_tb;
 
   //HW4
   integer gf, i, num,delay_c;
+  integer cycle_cnt = 0;     // clk cycles after reset (prog4 runs an uneven clk)
   logic [31:0] temp;
   integer err;
   string prog_path;
   always #(`CYCLE2/2) clk2 = ~clk2;
+  `ifdef DRAM_ASYNC
+  always #(`CYCLE3/2) clk3 = ~clk3;
+  `else
+  assign clk3 = clk;
+  `endif
   
   
   `ifdef prog3
@@ -77,6 +88,18 @@ module top_tb;
     clk = 0;
   end
   `endif
+  `ifdef prog6
+  always #(`CYCLE/2) clk = ~clk;
+  initial begin
+    clk = 0;
+  end
+  `endif
+  `ifdef prog7
+  always #(`CYCLE/2) clk = ~clk;
+  initial begin
+    clk = 0;
+  end
+  `endif
   `ifdef prog4
   initial begin
     clk = 0;
@@ -96,6 +119,10 @@ module top_tb;
     .clk2(clk2),
     .rst(rst),
     .rst2(rst2),
+  `ifdef DRAM_ASYNC
+    .clk3(clk3),
+    .rst3(rst3),
+  `endif
     .ROM_out(ROM_out),
     .DRAM_Q(DRAM_Q),
     .ROM_read(ROM_read),
@@ -120,9 +147,9 @@ module top_tb;
   );  
   
    DRAM i_DRAM(
-    .CK(clk), 
+    .CK(clk3), 
     .Q(DRAM_Q),
-    .RST(rst),
+    .RST(rst3),
     .CSn(DRAM_CSn),
     .WEn(DRAM_WEn),
     .RASn(DRAM_RASn),
@@ -132,6 +159,8 @@ module top_tb;
 	.VALID(DRAM_valid)
   ); 
   
+  always @(posedge clk) if (!rst) cycle_cnt <= cycle_cnt + 1;
+
   `ifdef UPF
   initial begin
       //supply_off("VDD");supply_off("VSS");
@@ -166,8 +195,13 @@ module top_tb;
   initial begin
     $display("CYCLE = %f, CYCLE2 = %f", `CYCLE, `CYCLE2);
     $value$plusargs("prog_path=%s", prog_path);
-    /*clk = 0;*/ clk2 = 0; rst = 1; rst2 = 1; 
-    #(`CYCLE+`CYCLE2) rst = 0; rst2 = 0;
+    /*clk = 0;*/ clk2 = 0; rst = 1; rst2 = 1; rst3 = 1;
+  `ifdef DRAM_ASYNC
+    clk3 = 0;
+    #(`CYCLE+`CYCLE2+`CYCLE3) rst = 0; rst2 = 0; rst3 = 0;
+  `else
+    #(`CYCLE+`CYCLE2) rst = 0; rst2 = 0; rst3 = 0;
+  `endif
 	$readmemh({prog_path, "/rom0.hex"}, i_ROM.Memory_byte0);
     $readmemh({prog_path, "/rom1.hex"}, i_ROM.Memory_byte1);
     $readmemh({prog_path, "/rom2.hex"}, i_ROM.Memory_byte2);
@@ -195,7 +229,11 @@ module top_tb;
       end
     end	
     $display("\nDone\n");
+    $display("Cycles: %0d", cycle_cnt);
     err = 0;
+  `ifdef DRAM_ASYNC
+    bridge_report();
+  `endif
 
     for (i = 0; i < num; i++)
     begin
@@ -246,6 +284,55 @@ module top_tb;
     $finish;
   end
   
+  `ifdef DRAM_ASYNC
+  // ------------------------------------------------------------
+  // AXI async bridge throughput (core side vs DRAM side beats)
+  // ------------------------------------------------------------
+  integer core_cycles, core_rbeats, core_wbeats, core_busy;
+  integer dram_cycles, dram_rbeats, dram_wbeats;
+  initial begin
+    core_cycles = 0; core_rbeats = 0; core_wbeats = 0; core_busy = 0;
+    dram_cycles = 0; dram_rbeats = 0; dram_wbeats = 0;
+  end
+
+  always @(posedge clk) if (!rst) begin
+    core_cycles = core_cycles + 1;
+    if (TOP.RVALID_S[5] && TOP.RREADY_S[5]) core_rbeats = core_rbeats + 1;
+    if (TOP.WVALID_S[5] && TOP.WREADY_S[5]) core_wbeats = core_wbeats + 1;
+    if (TOP.ARVALID_S[5] || TOP.AWVALID_S[5] || TOP.RVALID_S[5] || TOP.WVALID_S[5] || TOP.BVALID_S[5])
+      core_busy = core_busy + 1;
+  end
+
+  always @(posedge clk3) if (!rst3) begin
+    dram_cycles = dram_cycles + 1;
+    if (TOP.RVALID_D && TOP.RREADY_D) dram_rbeats = dram_rbeats + 1;
+    if (TOP.WVALID_D && TOP.WREADY_D) dram_wbeats = dram_wbeats + 1;
+  end
+
+  task bridge_report;
+    integer k;
+    begin
+      // beats still in the bridge FIFOs at SIM_END are not a mismatch:
+      // give them a few DRAM cycles to land before comparing
+      for (k = 0; k < 256 && (core_rbeats != dram_rbeats || core_wbeats != dram_wbeats); k++)
+        @(posedge clk);
+      $display("DRAM bridge: CYCLE = %f, CYCLE3 = %f", `CYCLE, `CYCLE3);
+      $display("  core side : %0d R beats, %0d W beats, %0d busy / %0d cycles",
+               core_rbeats, core_wbeats, core_busy, core_cycles);
+      $display("  DRAM side : %0d R beats, %0d W beats in %0d cycles",
+               dram_rbeats, dram_wbeats, dram_cycles);
+      if (core_busy > 0)
+        $display("  throughput: %f beats per busy core cycle",
+                 (core_rbeats + core_wbeats) * 1.0 / core_busy);
+      if (core_rbeats != dram_rbeats || core_wbeats != dram_wbeats)
+      begin
+        $display("  ERROR: beat count mismatch across bridge");
+        err = err + 1;
+      end
+    end
+  endtask
+  `endif
+
   task result;
     input integer err;
     input integer num;
@@ -24,8 +24,8 @@
 
 module AXI #(
     parameter int NUM_M     = 3,
-    parameter int NUM_S     = 6,
-    parameter int MIDX_BITS = 3,
+    parameter int NUM_S     = 8,
+    parameter int MIDX_BITS = 4,
     parameter int SIDX_BITS = 2
 )(
     input  logic clk,
@@ -137,7 +137,7 @@ module AXI #(
     logic [MIDX_BITS-1:0] MWIdx [NUM_M-1:0];
 
 	// ============================================================
-	// Default Slave Signals and Instance (Slave 6)
+	// Default Slave Signals and Instance (Slave 8)
 	// ============================================================
     // AR
 	logic [`AXI_IDS_BITS-1:0]   ARID_DEFAULT;
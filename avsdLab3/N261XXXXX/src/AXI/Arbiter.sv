@@ -1,7 +1,7 @@
 module Arbiter #(
     parameter int NUM_M     = 3,
-    parameter int NUM_S     = 6,
-    parameter int MIDX_BITS = 3,
+    parameter int NUM_S     = 8,
+    parameter int MIDX_BITS = 4,
     parameter int SIDX_BITS = 2
 ) (
     input  logic                      clk,
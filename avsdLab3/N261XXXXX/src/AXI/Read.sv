@@ -1,7 +1,7 @@
 module Read #(
     parameter int NUM_M     = 3,
-    parameter int NUM_S     = 6,
-    parameter int MIDX_BITS = 3,
+    parameter int NUM_S     = 8,
+    parameter int MIDX_BITS = 4,
     parameter int SIDX_BITS = 2
 ) (
     // From Arbiter
@@ -51,14 +51,16 @@ module Read #(
         32'h1002_0000, // S3: DMA
         32'h1001_0000, // S4: WDT
         32'h2000_0000, // S5: DRAM
-        32'h0000_0000  // S6: DEFAULT
+        32'h1003_0000, // S6: PIX
+        32'h1004_0000, // S7: HSEM
+        32'h0000_0000  // S8: DEFAULT
     };
 
     // Combinational multiplexing for AR and R channels
     always_comb begin
         // Assignments for slaves
         for (int s = 0; s < NUM_S+1; s++) begin
-            ARID_S[s]    = {4'd0, ARID_M[SRIdx[s]]};
+            ARID_S[s]    = {4'(SRIdx[s]), ARID_M[SRIdx[s]]};   // master index in ID[7:4]
             ARADDR_S[s]  = ARADDR_M[SRIdx[s]] - S_BEGIN[s+1];
             ARLEN_S[s]   = ARLEN_M[SRIdx[s]];
             ARSIZE_S[s]  = ARSIZE_M[SRIdx[s]];
@@ -1,6 +1,6 @@
 module Request_Decoder #(
     parameter int NUM_M = 3,
-    parameter int NUM_S = 6
+    parameter int NUM_S = 8
 ) (
     input  logic [NUM_M-1:0]                      ARVALID_M,
     input  logic [NUM_M-1:0]                      AWVALID_M,
@@ -20,7 +20,9 @@ module Request_Decoder #(
         32'h0002_0000, // DM
         32'h1002_0000, // DMA
         32'h1001_0000, // WDT
-        32'h2000_0000  // DRAM
+        32'h2000_0000, // DRAM
+        32'h1003_0000, // PIX
+        32'h1004_0000  // HSEM
     };
 
     localparam logic [`AXI_ADDR_BITS-1:0] S_END [0:NUM_S-1] = '{
@@ -29,7 +31,9 @@ module Request_Decoder #(
         32'h0002_FFFF, // DM
         32'h1002_0200, // DMA
         32'h1001_03FF, // WDT
-        32'h201F_FFFF  // DRAM
+        32'h201F_FFFF, // DRAM
+        32'h1003_2FFF, // PIX
+        32'h1004_0FFF  // HSEM
     };
 
     // ============================================================
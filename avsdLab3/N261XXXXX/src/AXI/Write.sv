@@ -2,8 +2,8 @@
 
 module Write #(
     parameter int NUM_M     = 3,
-    parameter int NUM_S     = 6,
-    parameter int MIDX_BITS = 3,
+    parameter int NUM_S     = 8,
+    parameter int MIDX_BITS = 4,
     parameter int SIDX_BITS = 2
 ) (
     // From Arbiter
@@ -63,7 +63,9 @@ module Write #(
         32'h1002_0000, // S3: DMA 32'h1002_0000
         32'h1001_0000, // S4: WDT 32'h1001_0000
         32'h2000_0000, // S5: DRAM
-        32'h0000_0000  // S6: DEFAULT
+        32'h1003_0000, // S6: PIX
+        32'h1004_0000, // S7: HSEM
+        32'h0000_0000  // S8: DEFAULT
     };
 
 
@@ -71,7 +73,7 @@ module Write #(
     always_comb begin
         // Assignments for slaves
         for (int s = 0; s < NUM_S+1; s++) begin
-            AWID_S[s]    = {4'd0, AWID_M[SWIdx[s]]};
+            AWID_S[s]    = {4'(SWIdx[s]), AWID_M[SWIdx[s]]};   // master index in ID[7:4]
             AWADDR_S[s]  = AWADDR_M[SWIdx[s]] - S_BEGIN[s+1];
             AWLEN_S[s]   = AWLEN_M[SWIdx[s]];
             AWSIZE_S[s]  = AWSIZE_M[SWIdx[s]];
@@ -0,0 +1,102 @@
+module AFIFO #(
+    parameter int DATA_WIDTH = 32,
+    parameter int DEPTH      = 4    // power of 2, >= 4
+) (
+    // Write domain
+    input  logic                  wclk,     // Write clock
+    input  logic                  wrst,     // Write reset
+    input  logic                  wpush,    // Write push
+    input  logic [DATA_WIDTH-1:0] wdata,    // Write data
+    output logic                  wfull,    // Write full flag
+
+    // Read domain
+    input  logic                  rclk,     // Read clock
+    input  logic                  rrst,     // Read reset
+    input  logic                  rpop,     // Read pop
+    output logic [DATA_WIDTH-1:0] rdata,    // Read data (head, valid when !rempty)
+    output logic                  rempty    // Read empty flag
+);
+
+    // ============================================================
+    // Local Parameters
+    // ============================================================
+    localparam int ADDR_WIDTH = $clog2(DEPTH);
+
+    // ============================================================
+    // Storage and Pointers
+    // ------------------------------------------------------------
+    // Pointers carry one extra wrap bit and cross domains in Gray
+    // code through 2-flop synchronizers, so at most one bit of a
+    // synchronized pointer can be in flight at a time.
+    // ============================================================
+    logic [DATA_WIDTH-1:0]  fifo_memory [DEPTH-1:0];
+
+    logic [ADDR_WIDTH:0]    wbin, wgray, wbin_next, wgray_next;
+    logic [ADDR_WIDTH:0]    rbin, rgray, rbin_next, rgray_next;
+    logic [ADDR_WIDTH:0]    rgray_sync_stage1, rgray_sync_stage2;
+    logic [ADDR_WIDTH:0]    wgray_sync_stage1, wgray_sync_stage2;
+
+    // ============================================================
+    // Write Domain
+    // ============================================================
+    assign wbin_next  = wbin + {{ADDR_WIDTH{1'b0}}, (wpush & ~wfull)};
+    assign wgray_next = (wbin_next >> 1) ^ wbin_next;
+
+    always_ff @(posedge wclk or posedge wrst) begin
+        if (wrst) begin
+            rgray_sync_stage1 <= '0;
+            rgray_sync_stage2 <= '0;
+        end else begin
+            rgray_sync_stage1 <= rgray;
+            rgray_sync_stage2 <= rgray_sync_stage1;
+        end
+    end
+
+    always_ff @(posedge wclk or posedge wrst) begin
+        if (wrst) begin
+            wbin  <= '0;
+            wgray <= '0;
+            wfull <= 1'b0;
+        end else begin
+            wbin  <= wbin_next;
+            wgray <= wgray_next;
+            wfull <= (wgray_next == {~rgray_sync_stage2[ADDR_WIDTH:ADDR_WIDTH-1], rgray_sync_stage2[ADDR_WIDTH-2:0]});
+        end
+    end
+
+    always_ff @(posedge wclk) begin
+        if (wpush && ~wfull)
+            fifo_memory[wbin[ADDR_WIDTH-1:0]] <= wdata;
+    end
+
+    // ============================================================
+    // Read Domain
+    // ============================================================
+    assign rbin_next  = rbin + {{ADDR_WIDTH{1'b0}}, (rpop & ~rempty)};
+    assign rgray_next = (rbin_next >> 1) ^ rbin_next;
+
+    always_ff @(posedge rclk or posedge rrst) begin
+        if (rrst) begin
+            wgray_sync_stage1 <= '0;
+            wgray_sync_stage2 <= '0;
+        end else begin
+            wgray_sync_stage1 <= wgray;
+            wgray_sync_stage2 <= wgray_sync_stage1;
+        end
+    end
+
+    always_ff @(posedge rclk or posedge rrst) begin
+        if (rrst) begin
+            rbin   <= '0;
+            rgray  <= '0;
+            rempty <= 1'b1;
+        end else begin
+            rbin   <= rbin_next;
+            rgray  <= rgray_next;
+            rempty <= (rgray_next == wgray_sync_stage2);
+        end
+    end
+
+    assign rdata = fifo_memory[rbin[ADDR_WIDTH-1:0]];
+
+endmodule
@@ -0,0 +1,240 @@
+`include "../include/AXI_define.svh"
+`include "../src/CDC_lib/AFIFO.sv"
+
+// ============================================================
+// AXI Clock-Domain Bridge
+// ------------------------------------------------------------
+// Connects one AXI slave port of the interconnect (s_clk side)
+// to a slave wrapper running on its own clock (m_clk side).
+// Each of the five channels goes through its own AFIFO, so both
+// sides keep full valid/ready semantics and one beat per cycle
+// of the slower clock once the FIFOs are primed.
+// ============================================================
+module AXI_CDC_Bridge #(
+    parameter int ADDR_DEPTH = 4,   // AW / AR / B channel FIFO depth
+    parameter int DATA_DEPTH = 8    // W / R channel FIFO depth
+) (
+    // =============================================================================
+    // Interconnect side (slave port)
+    // =============================================================================
+    input  logic                        s_clk,
+    input  logic                        s_rst,
+
+    // ReadAddress
+    input  logic [`AXI_IDS_BITS-1:0]    ARID_S,
+    input  logic [`AXI_ADDR_BITS-1:0]   ARADDR_S,
+    input  logic [`AXI_LEN_BITS-1:0]    ARLEN_S,
+    input  logic [`AXI_SIZE_BITS-1:0]   ARSIZE_S,
+    input  logic [1:0]                  ARBURST_S,
+    input  logic                        ARVALID_S,
+    output logic                        ARREADY_S,
+
+    // ReadData
+    output logic [`AXI_IDS_BITS-1:0]    RID_S,
+    output logic [`AXI_DATA_BITS-1:0]   RDATA_S,
+    output logic [1:0]                  RRESP_S,
+    output logic                        RLAST_S,
+    output logic                        RVALID_S,
+    input  logic                        RREADY_S,
+
+    // WriteAddress
+    input  logic [`AXI_IDS_BITS-1:0]    AWID_S,
+    input  logic [`AXI_ADDR_BITS-1:0]   AWADDR_S,
+    input  logic [`AXI_LEN_BITS-1:0]    AWLEN_S,
+    input  logic [`AXI_SIZE_BITS-1:0]   AWSIZE_S,
+    input  logic [1:0]                  AWBURST_S,
+    input  logic                        AWVALID_S,
+    output logic                        AWREADY_S,
+
+    // WriteData
+    input  logic [`AXI_DATA_BITS-1:0]   WDATA_S,
+    input  logic [`AXI_STRB_BITS-1:0]   WSTRB_S,
+    input  logic                        WLAST_S,
+    input  logic                        WVALID_S,
+    output logic                        WREADY_S,
+
+    // WriteResponse
+    output logic [`AXI_IDS_BITS-1:0]    BID_S,
+    output logic [1:0]                  BRESP_S,
+    output logic                        BVALID_S,
+    input  logic                        BREADY_S,
+
+    // =============================================================================
+    // Slave side (master port into the wrapper)
+    // =============================================================================
+    input  logic                        m_clk,
+    input  logic                        m_rst,
+
+    // ReadAddress
+    output logic [`AXI_IDS_BITS-1:0]    ARID_M,
+    output logic [`AXI_ADDR_BITS-1:0]   ARADDR_M,
+    output logic [`AXI_LEN_BITS-1:0]    ARLEN_M,
+    output logic [`AXI_SIZE_BITS-1:0]   ARSIZE_M,
+    output logic [1:0]                  ARBURST_M,
+    output logic                        ARVALID_M,
+    input  logic                        ARREADY_M,
+
+    // ReadData
+    input  logic [`AXI_IDS_BITS-1:0]    RID_M,
+    input  logic [`AXI_DATA_BITS-1:0]   RDATA_M,
+    input  logic [1:0]                  RRESP_M,
+    input  logic                        RLAST_M,
+    input  logic                        RVALID_M,
+    output logic                        RREADY_M,
+
+    // WriteAddress
+    output logic [`AXI_IDS_BITS-1:0]    AWID_M,
+    output logic [`AXI_ADDR_BITS-1:0]   AWADDR_M,
+    output logic [`AXI_LEN_BITS-1:0]    AWLEN_M,
+    output logic [`AXI_SIZE_BITS-1:0]   AWSIZE_M,
+    output logic [1:0]                  AWBURST_M,
+    output logic                        AWVALID_M,
+    input  logic                        AWREADY_M,
+
+    // WriteData
+    output logic [`AXI_DATA_BITS-1:0]   WDATA_M,
+    output logic [`AXI_STRB_BITS-1:0]   WSTRB_M,
+    output logic                        WLAST_M,
+    output logic                        WVALID_M,
+    input  logic                        WREADY_M,
+
+    // WriteResponse
+    input  logic [`AXI_IDS_BITS-1:0]    BID_M,
+    input  logic [1:0]                  BRESP_M,
+    input  logic                        BVALID_M,
+    output logic                        BREADY_M
+);
+
+    // ============================================================
+    // Local Parameters
+    // ============================================================
+    localparam int A_WIDTH = `AXI_IDS_BITS + `AXI_ADDR_BITS + `AXI_LEN_BITS + `AXI_SIZE_BITS + 2;
+    localparam int W_WIDTH = `AXI_DATA_BITS + `AXI_STRB_BITS + 1;
+    localparam int B_WIDTH = `AXI_IDS_BITS + 2;
+    localparam int R_WIDTH = `AXI_IDS_BITS + `AXI_DATA_BITS + 2 + 1;
+
+    // ============================================================
+    // Local Signals
+    // ============================================================
+    logic               aw_full, aw_empty;
+    logic               w_full,  w_empty;
+    logic               b_full,  b_empty;
+    logic               ar_full, ar_empty;
+    logic               r_full,  r_empty;
+
+    // ============================================================
+    // WriteAddress Channel (s_clk -> m_clk)
+    // ============================================================
+    AFIFO #(
+        .DATA_WIDTH (A_WIDTH    ),
+        .DEPTH      (ADDR_DEPTH )
+    ) aw_fifo (
+        .wclk       (s_clk      ),
+        .wrst       (s_rst      ),
+        .wpush      (AWVALID_S  ),
+        .wdata      ({AWID_S, AWADDR_S, AWLEN_S, AWSIZE_S, AWBURST_S}),
+        .wfull      (aw_full    ),
+
+        .rclk       (m_clk      ),
+        .rrst       (m_rst      ),
+        .rpop       (AWREADY_M  ),
+        .rdata      ({AWID_M, AWADDR_M, AWLEN_M, AWSIZE_M, AWBURST_M}),
+        .rempty     (aw_empty   )
+    );
+
+    assign AWREADY_S = ~aw_full;
+    assign AWVALID_M = ~aw_empty;
+
+    // ============================================================
+    // WriteData Channel (s_clk -> m_clk)
+    // ============================================================
+    AFIFO #(
+        .DATA_WIDTH (W_WIDTH    ),
+        .DEPTH      (DATA_DEPTH )
+    ) w_fifo (
+        .wclk       (s_clk      ),
+        .wrst       (s_rst      ),
+        .wpush      (WVALID_S   ),
+        .wdata      ({WDATA_S, WSTRB_S, WLAST_S}),
+        .wfull      (w_full     ),
+
+        .rclk       (m_clk      ),
+        .rrst       (m_rst      ),
+        .rpop       (WREADY_M   ),
+        .rdata      ({WDATA_M, WSTRB_M, WLAST_M}),
+        .rempty     (w_empty    )
+    );
+
+    assign WREADY_S = ~w_full;
+    assign WVALID_M = ~w_empty;
+
+    // ============================================================
+    // WriteResponse Channel (m_clk -> s_clk)
+    // ============================================================
+    AFIFO #(
+        .DATA_WIDTH (B_WIDTH    ),
+        .DEPTH      (ADDR_DEPTH )
+    ) b_fifo (
+        .wclk       (m_clk      ),
+        .wrst       (m_rst      ),
+        .wpush      (BVALID_M   ),
+        .wdata      ({BID_M, BRESP_M}),
+        .wfull      (b_full     ),
+
+        .rclk       (s_clk      ),
+        .rrst       (s_rst      ),
+        .rpop       (BREADY_S   ),
+        .rdata      ({BID_S, BRESP_S}),
+        .rempty     (b_empty    )
+    );
+
+    assign BREADY_M = ~b_full;
+    assign BVALID_S = ~b_empty;
+
+    // ============================================================
+    // ReadAddress Channel (s_clk -> m_clk)
+    // ============================================================
+    AFIFO #(
+        .DATA_WIDTH (A_WIDTH    ),
+        .DEPTH      (ADDR_DEPTH )
+    ) ar_fifo (
+        .wclk       (s_clk      ),
+        .wrst       (s_rst      ),
+        .wpush      (ARVALID_S  ),
+        .wdata      ({ARID_S, ARADDR_S, ARLEN_S, ARSIZE_S, ARBURST_S}),
+        .wfull      (ar_full    ),
+
+        .rclk       (m_clk      ),
+        .rrst       (m_rst      ),
+        .rpop       (ARREADY_M  ),
+        .rdata      ({ARID_M, ARADDR_M, ARLEN_M, ARSIZE_M, ARBURST_M}),
+        .rempty     (ar_empty   )
+    );
+
+    assign ARREADY_S = ~ar_full;
+    assign ARVALID_M = ~ar_empty;
+
+    // ============================================================
+    // ReadData Channel (m_clk -> s_clk)
+    // ============================================================
+    AFIFO #(
+        .DATA_WIDTH (R_WIDTH    ),
+        .DEPTH      (DATA_DEPTH )
+    ) r_fifo (
+        .wclk       (m_clk      ),
+        .wrst       (m_rst      ),
+        .wpush      (RVALID_M   ),
+        .wdata      ({RID_M, RDATA_M, RRESP_M, RLAST_M}),
+        .wfull      (r_full     ),
+
+        .rclk       (s_clk      ),
+        .rrst       (s_rst      ),
+        .rpop       (RREADY_S   ),
+        .rdata      ({RID_S, RDATA_S, RRESP_S, RLAST_S}),
+        .rempty     (r_empty    )
+    );
+
+    assign RREADY_M = ~r_full;
+    assign RVALID_S = ~r_empty;
+
+endmodule
@@ -1,4 +1,6 @@
-module ALU (
+module ALU #(
+    parameter bit HAS_MUL = 1'b1    // 0: M-extension handled by Multiplier
+) (
     input  [31:0] src1,
     input  [31:0] src2,
     input  [4:0]  opcode,
@@ -15,6 +17,7 @@ module ALU (
     logic sign;
     logic [31:0] add_4_res, add_res, sub_res, xor_res, or_res, and_res;
     logic [31:0] slt_res, sltu_res, sll_res, srl_res, sra_res;
+    logic [31:0] shadd_res;
 
     // ============================================================
     // Multiplication handling (M-extension)
@@ -60,6 +63,7 @@ module ALU (
         sra_res   = $signed(src1) >>> src2[4:0];
         sll_res   = src1 << src2[4:0];
         slt_res   = {31'd0, $signed(src1) < $signed(src2)};
+        shadd_res = (src1 << func[3:2]) + src2;   // SH1ADD 01, SH2ADD 10, SH3ADD 11
     end
 
     // ============================================================
@@ -72,7 +76,9 @@ module ALU (
             // ----------------------------------------------------
             `OP_RM_TYPE: begin
                 if (is_mtype) begin
-                    if (func[3:1] == `FUNC_MUL)
+                    if (!HAS_MUL)
+                        aluOut = 32'd0;
+                    else if (func[3:1] == `FUNC_MUL)
                         aluOut = mul_res[31:0];      // MUL (low 32-bit)
                     else
                         aluOut = mul_res[63:32];     // MULH / MULHSU / MULHU (high 32-bit)
@@ -88,6 +94,9 @@ module ALU (
                         `FUNC_SRA:  aluOut = sra_res;
                         `FUNC_OR:   aluOut = or_res;
                         `FUNC_AND:  aluOut = and_res;
+                        `FUNC_SH1ADD,
+                        `FUNC_SH2ADD,
+                        `FUNC_SH3ADD: aluOut = shadd_res;   // fused slli + add
                         default:    aluOut = 32'd0;
                     endcase
                 end
@@ -133,6 +142,13 @@ module ALU (
                 endcase
             end
 
+            // ----------------------------------------------------
+            // Fused slt(u) + beq/bne: rd gets the compare result,
+            // which is also the branch flag (Controller_EX applies
+            // the beq inversion)
+            // ----------------------------------------------------
+            `OP_CMP_BR: aluOut = func[0] ? sltu_res : slt_res;
+
             // ----------------------------------------------------
             // Upper immediates & jumps
             // ----------------------------------------------------
@@ -1,15 +1,14 @@
 module Branch_Predictor#(
     parameter int BTB_ENTRIES = 16,
-    parameter int PHT_ENTRIES = 16
+    parameter int PHT_ENTRIES = 16,
+    parameter bit REG_LOOKUP  = 1'b0   // 1: register the IF prediction (split fetch)
 ) (
     input  logic         clk,
     input  logic         rst,
-    input  logic         IF_DONE,
-    input  logic         MEM_DONE,
-    input  logic         DMA_interrupt,
-    input  logic         WTO_interrupt,
+    input  logic         EX_ready,
 
     input  logic [31:0]  IF_PC,
+    input  logic [31:0]  IF_nextPC, // REG_LOOKUP: looked up a cycle ahead
     output logic         IF_pTaken,
     output logic [31:0]  IF_pTarget,
     input  logic [1:0]   EX_bType,  // 00: others, 01: JAL, 10: Btype
@@ -53,11 +52,14 @@ module Branch_Predictor#(
     // ============================================================
     // Local Signals
     // ============================================================
+    logic [31:0]                lookupPC;
     logic [GHR_WIDTH-1:0]       IF_LPC, IF_PHTIdx;
     logic [GHR_WIDTH-1:0]       EX_LPC, EX_PHTIdx;
     logic [BTB_INDEX_WIDTH-1:0] IF_BTBIdx, EX_BTBIdx;
     logic [BTB_TAG_WIDTH-1:0]   IF_tag, EX_tag;
     logic                       IF_JAL, BTB_hit;
+    logic                       lookup_taken;
+    logic [31:0]                lookup_target;
 
     logic [1:0]                 EX_count,IF_count;
     logic [1:0]                 nextCount;
@@ -67,13 +69,14 @@ module Branch_Predictor#(
     // ============================================================
     assign EX_BTBIdx  = EX_PC[BTB_INDEX_WIDTH + 1 : 2];
     assign EX_tag     = EX_PC[31 : BTB_INDEX_WIDTH + 2];
-    assign IF_BTBIdx  = IF_PC[BTB_INDEX_WIDTH + 1 : 2];
-    assign IF_tag     = IF_PC[31 : BTB_INDEX_WIDTH + 2];
+    assign lookupPC   = REG_LOOKUP ? IF_nextPC : IF_PC;
+    assign IF_BTBIdx  = lookupPC[BTB_INDEX_WIDTH + 1 : 2];
+    assign IF_tag     = lookupPC[31 : BTB_INDEX_WIDTH + 2];
 
     // ============================================================
     // PHT Index (GHR XOR PC bits)
     // ============================================================
-    assign IF_LPC     = IF_PC[GHR_WIDTH + 1 : 2];
+    assign IF_LPC     = lookupPC[GHR_WIDTH + 1 : 2];
     assign EX_LPC     = EX_PC[GHR_WIDTH + 1 : 2];
     assign IF_PHTIdx  = IF_LPC ^ ghr;
     assign EX_PHTIdx  = EX_LPC ^ ghr;
@@ -85,9 +88,32 @@ module Branch_Predictor#(
     assign IF_count   = pht_mem[IF_PHTIdx];
     assign BTB_hit    = btb_mem[EX_BTBIdx].valid && (btb_mem[EX_BTBIdx].tag == EX_tag);
 
-    assign IF_JAL     = btb_mem[IF_BTBIdx].isJAL;
-    assign IF_pTaken  = btb_mem[IF_BTBIdx].valid && (btb_mem[IF_BTBIdx].tag == IF_tag) && (IF_JAL || !IF_count[0]);
-    assign IF_pTarget = btb_mem[IF_BTBIdx].target;
+    assign IF_JAL        = btb_mem[IF_BTBIdx].isJAL;
+    assign lookup_taken  = btb_mem[IF_BTBIdx].valid && (btb_mem[IF_BTBIdx].tag == IF_tag) && (IF_JAL || !IF_count[0]);
+    assign lookup_target = btb_mem[IF_BTBIdx].target;
+
+    // ------------------------------------------------------------
+    // With REG_LOOKUP the lookup is done on the PC fetch moves to
+    // next and registered, so the prediction for the current PC
+    // is there in the same cycle as the combinational lookup's,
+    // even when burst beats move the PC every cycle.
+    // ------------------------------------------------------------
+    generate
+        if (REG_LOOKUP) begin : g_reg_lookup
+            always_ff @(posedge clk or posedge rst) begin
+                if (rst) begin
+                    IF_pTaken  <= 1'b0;
+                    IF_pTarget <= 32'd0;
+                end else begin
+                    IF_pTaken  <= lookup_taken;
+                    IF_pTarget <= lookup_target;
+                end
+            end
+        end else begin : g_comb_lookup
+            assign IF_pTaken  = lookup_taken;
+            assign IF_pTarget = lookup_target;
+        end
+    endgenerate
 
 
     // ============================================================
@@ -108,20 +134,10 @@ module Branch_Predictor#(
             end
             for (i = 0; i < PHT_ENTRIES; i=i+1)
                 pht_mem[i] <= wTaken;
-        end else if (DMA_interrupt ||WTO_interrupt) begin
-            ghr <= {GHR_WIDTH{1'b0}};
-            for (i = 0; i < BTB_ENTRIES; i=i+1) begin
-                btb_mem[i].valid  <= 1'b0;
-                btb_mem[i].tag    <= {BTB_TAG_WIDTH{1'b0}};
-                btb_mem[i].target <= 32'b0;
-                btb_mem[i].isJAL  <= 1'b0;
-            end
-            for (i = 0; i < PHT_ENTRIES; i=i+1)
-                pht_mem[i] <= wTaken;
         // ---------------------------------------
         // Update
         // ---------------------------------------
-        end else if (IF_DONE && MEM_DONE) begin
+        end else if (EX_ready) begin
             // Branch
             if (EX_bType == 2'b10) begin
                 ghr <= {ghr[GHR_WIDTH-1:1], EX_rTaken};
@@ -0,0 +1,72 @@
+module Branch_Unit (
+    input  logic        valid,          // op resolves this cycle
+    input  logic [4:0]  op,
+    input  logic [3:0]  func,
+    input  logic [31:0] pc,
+    input  logic [31:0] src1,           // forwarded rs1 (registered)
+    input  logic [31:0] src2,           // forwarded rs2 (registered)
+    input  logic [31:0] imm,
+    input  logic        pTaken,
+    input  logic [31:0] pTarget,
+
+    output logic        rTaken,
+    output logic [1:0]  bType,          // 00: others, 01: JAL, 10: Btype
+    output logic [31:0] bTarget,
+    output logic        wrongBranch,
+    output logic [31:0] cTarget
+);
+
+    // ============================================================
+    // Local Signals
+    // ============================================================
+    logic        eq, lt, ltu;
+    logic [31:0] jbSrc1;
+
+    // ============================================================
+    // Branch Compare
+    // ------------------------------------------------------------
+    // Deep pipeline EX2: the compare that the ALU does for
+    // branches in EX1 of the base pipeline, on operands that
+    // were forwarded in EX1 and registered.
+    // A fused cmp-br holds slt(u) in the flag; beq takes it on 0.
+    // ============================================================
+    always_comb begin
+        eq  = (src1 == src2);
+        lt  = ($signed(src1) < $signed(src2));
+        ltu = (src1 < src2);
+
+        case (op)
+            `OP_B_TYPE: begin
+                case (func[3:1])
+                    `BR_EQ : rTaken = eq;
+                    `BR_NE : rTaken = ~eq;
+                    `BR_LT : rTaken = lt;
+                    `BR_GE : rTaken = ~lt;
+                    `BR_LTU: rTaken = ltu;
+                    `BR_GEU: rTaken = ~ltu;
+                    default: rTaken = 1'b0;
+                endcase
+            end
+            `OP_CMP_BR:          rTaken = (func[0] ? ltu : lt) ^ (func[3:1] == `BR_EQ);
+            `OP_JAL, `OP_JALR:   rTaken = 1'b1;
+            default:             rTaken = 1'b0;
+        endcase
+    end
+
+    // ============================================================
+    // Target and Prediction Correction
+    // ------------------------------------------------------------
+    // Same rules as Controller_EX: a taken prediction to the wrong
+    // target (stale BTB entry) is corrected like a wrong direction.
+    // ============================================================
+    always_comb begin
+        bType       = ~valid                                      ? 2'b00 :
+                      (op == `OP_B_TYPE || op == `OP_CMP_BR)      ? 2'b10 :
+                      (op == `OP_JAL)                             ? 2'b01 : 2'b00;
+        jbSrc1      = (op == `OP_JALR) ? src1 : pc;
+        bTarget     = (jbSrc1 + imm) & (~32'd3);
+        wrongBranch = valid && ((rTaken ^ pTaken) || (rTaken && pTaken && (pTarget != bTarget)));
+        cTarget     = (!rTaken && pTaken) ? (pc + 32'd4) : bTarget;
+    end
+
+endmodule
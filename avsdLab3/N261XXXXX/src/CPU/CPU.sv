@@ -12,17 +12,21 @@
 
 `include "../src/CPU/Hazard_Detector.sv"
 `include "../src/CPU/Branch_Predictor.sv"
+`include "../src/CPU/Branch_Unit.sv"
 `include "../src/CPU/Program_Counter.sv"
 `include "../src/CPU/Decoder.sv"
 `include "../src/CPU/Register_File.sv"
 `include "../src/CPU/Immediate_Generator.sv"
 `include "../src/CPU/ALU.sv"
+`include "../src/CPU/Multiplier.sv"
 `include "../src/CPU/FPU.sv"
 `include "../src/CPU/CSR_File.sv"
 `include "../src/CPU/Load_Filter.sv"
 `include "../src/CPU/Store_Filter.sv"
 
-module CPU (
+module CPU #(
+    parameter int HART_ID = 0
+) (
     input  logic        clk,
     input  logic        rst,
 
@@ -30,37 +34,81 @@ module CPU (
     input  logic        WTO_interrupt,
 
     input  logic [31:0] IF_RdData,
+    input  logic        IF_BEAT,
     input  logic        IF_DONE,
     input  logic [31:0] MEM_RdData,
     input  logic        MEM_DONE,
 
     output logic        IF_VALID,
     output logic [31:0] IF_ADDR,
+    output logic [ 3:0] IF_LEN,
     output logic        MEM_VALID,
     output logic [31:0] MEM_ADDR,
     output logic [31:0] MEM_WrData,
     output logic        MEM_WEB,
+    output logic        MEM_FENCE,
     output logic [ 3:0] MEM_STRB
 );
+    // ============================================================
+    // Pipeline Variant
+    // ------------------------------------------------------------
+    // CPU_DEEP (make DEEP=1) builds the deeper pipeline:
+    //   IF1  PC + BTB lookup (prediction registered)
+    //   IF2  instruction fetch
+    //   ID
+    //   EX1  forwarding, ALU; MUL operand magnitude, FPU first half
+    //   EX2  branch compare / target / mispredict check on the
+    //        registered EX1 operands (Branch_Unit); FPU second half
+    //   MEM1 AR / AW registered in the wrapper; MUL partial products
+    //   MEM2 data phase
+    //   WB   MUL sum
+    // Every redirect (EX2 mispredict, trap / mret) is registered
+    // and applied to the front end a cycle later.
+    // MUL is pipelined alongside EX-MEM-WB and issues every cycle;
+    // a user of its result stalls in ID until the MUL is in WB and
+    // reads it through WB->ID. FPU holds EX for two cycles; MEM
+    // and WB keep draining meanwhile and EX-MEM takes bubbles, so
+    // the unit captures its operands in the first cycle, while the
+    // producers are still reachable through MEM->EX / WB->EX.
+    // EX2 branch operands are the EX1 forwarded values; the
+    // branch only writes rd (pc + 4) from EX1, so EX2 adds no
+    // forwarding source.
+    // ============================================================
+`ifdef CPU_DEEP
+    localparam bit DEEP = 1'b1;
+`else
+    localparam bit DEEP = 1'b0;
+`endif
+
     // ============================================================
     // Local Signals
     // ============================================================
     // -------------------------------------
     // IF Stage
     // -------------------------------------
-    logic [31:0]    IF_pc;
+    logic [31:0]    IF_pc, IF_nextPc;
     logic           IF_pTaken;
     logic [31:0]    IF_pTarget;
+    logic           IF_drop, IF_push;
+    logic [ 3:0]    IFQ_room;
 
     // -------------------------------------
     // ID Stage
     // -------------------------------------
+    logic           ID_valid, ID_pop;
     logic [31:0]    ID_pc;
     logic [31:0]    ID_inst;
     logic           ID_pTaken;
+    logic [31:0]    ID_pTarget;
     logic [ 4:0]    ID_rs1, ID_rs2, ID_rd;
     logic [ 4:0]    ID_op;
     logic [ 3:0]    ID_func;
+    logic [ 4:0]    ID_dec1Rs1, ID_dec1Rs2, ID_dec1Rd, ID_dec1Op;
+    logic [ 3:0]    ID_dec1Func;
+    logic           ID_dec1IsM;
+    logic [ 4:0]    ID_dec2Rs1, ID_dec2Rs2, ID_dec2Rd, ID_dec2Op;
+    logic [ 3:0]    ID_dec2Func;
+    logic           ID_dec2IsM;
     logic           ID_is_mtype, ID_is_fsub;
     logic           ID_WFI, ID_MRET;
     logic [11:0]    ID_csrIdx;
@@ -69,17 +117,25 @@ module CPU (
     logic [31:0]    ID_Imm;
     logic           ID_use_rs1, ID_use_rs2;
     logic           ID_use_frs1, ID_use_frs2;
+    logic           ID_valid2, ID_pTaken2;
+    logic [31:0]    ID_pc2, ID_inst2, ID_pTarget2, ID_Imm2;
+    logic           ID_fuse;
+    logic [ 1:0]    ID_fuseType;
+    logic [31:0]    ID_opPc, ID_opImm, ID_opPTarget;
+    logic           ID_opPTaken;
 
     // -------------------------------------
     // EX Stage
     // -------------------------------------
+    logic           EX_valid, EX_retire;
     logic [31:0]    EX_pc;
     logic           EX_pTaken, EX_rTaken;
+    logic [31:0]    EX_pTarget;
     logic [ 4:0]    EX_rs1, EX_rs2, EX_rd;
     logic [ 4:0]    EX_op;
     logic [ 3:0]    EX_func;
     logic           EX_is_mtype, EX_is_fsub;
-    logic           EX_WFI, EX_MRET;
+    logic           EX_WFI, EX_MRET, EX_fused;
     logic [11:0]    EX_csrIdx;
     logic [31:0]    EX_rs1_data, EX_rs2_data;
     logic [31:0]    EX_Imm;
@@ -89,12 +145,19 @@ module CPU (
     logic [31:0]    EX_ALU_src1, EX_ALU_src2, EX_CSR_src2;
     logic [31:0]    EX_JB_src1;
     logic [31:0]    EX_Forward_rs1data, EX_Forward_rs2data;
-    logic [31:0]    aluOut, fpuOut, csrOut;
+    logic [31:0]    aluOut, fpuOut, mulOut, csrOut;
+    logic           EX_long, EX_busy, EX_kill, EX_drop;
+    logic           exStep;
+    logic           exLoad;
+    logic           EX_mul;
     logic [31:0]    EX_aluOut;
     logic [31:0]    EX_cTarget;
     logic [31:0]    EX_bTarget;
     logic           EX_interrupt_taken, EX_interrupt_return, EX_IF_VALIDn;
-    logic           EX_MIE, EX_MEIE, EX_MTIE, EX_MEIP, EX_MTIP;
+    logic           EX_interrupt_chain, EX_csrEn;
+    logic           ctrIntTaken, ctrIntReturn, ctrIntChain, ctrCsrEn;
+    logic [ 3:0]    EX_cause;
+    logic           EX_MIE, EX_MPIE, EX_MEIE, EX_MTIE, EX_MEIP, EX_MTIP;
     logic [31:0]    EX_MTVEC, EX_MEPC, EX_mepc, EX_fTarget;
 
     // -------------------------------------
@@ -105,6 +168,9 @@ module CPU (
     logic [ 2:0]    MEM_func3;
     logic [31:0]    MEM_aluOut;
     logic [31:0]    MEM_rs2_data;
+    logic           MEM_split, MEM_upper;
+    logic [31:0]    MEM_RdLo, MEM_RdWord;
+    logic           MEM_mul;
 
     // -------------------------------------
     // WB Stage
@@ -113,11 +179,12 @@ module CPU (
     logic [ 4:0]    WB_op;
     logic [ 2:0]    WB_func3;
     logic [31:0]    WB_aluOut;
-    logic [31:0]    WB_ReadData;
+    logic [31:0]    WB_ReadData, WB_ReadDataHi;
     logic           WB_wbSel;
     logic           WB_wbEnable;
     logic           WB_fwbEnable;
-    logic [31:0]    WB_wbData;
+    logic [31:0]    WB_wbData, WB_fwdData;
+    logic           WB_mul;
     logic [31:0]    WB_loadData;
 
     // -------------------------------------
@@ -129,16 +196,190 @@ module CPU (
     // -------------------------------------
     // Interface
     // -------------------------------------
-    logic          IF_VALIDn;
+    logic           IF_VALIDn, fetchOff;
 
     // -------------------------------------
     // Stall / Flush
     // -------------------------------------
-    logic           stallIF, stallID, stallEX, stallCSR;
-    logic           flushIF, flushID, flushEX, flushCSR;
+    logic           stallID, stallEX;
+    logic           flushIF, flushID, flushEX;
+    logic           redirect;
+    logic           ctrFlushIF, ctrFlushID, ctrFlushEX;
+    logic [31:0]    ctrFTarget;
+    logic           rdPending;
+    logic [31:0]    rdTarget;
+
+    // -------------------------------------
+    // EX2 Branch Resolve (deep pipeline)
+    // -------------------------------------
+    logic           br2Valid, br2PTaken, br2Wrong;
+    logic [ 4:0]    br2Op;
+    logic [ 3:0]    br2Func;
+    logic [31:0]    br2Pc, br2Src1, br2Src2, br2Imm, br2PTarget;
+    logic [31:0]    br2CTarget;
+
+    // -------------------------------------
+    // Branch Predictor Update
+    // -------------------------------------
+    logic           bpReady, bpRTaken;
+    logic [ 1:0]    bpBType;
+    logic [31:0]    bpPc, bpBTarget;
+
+    // -------------------------------------
+    // Stage Handshake
+    // -------------------------------------
+    logic           EX_ready, MEM_ready;
+
+
+
+
+    // ============================================================
+    // Stage Handshake
+    // ------------------------------------------------------------
+    // The front end (PC, fetch, IF-ID queue) and the back end
+    // (ID-EX, EX-MEM, MEM-WB) are decoupled: fetch only waits on
+    // the queue having room, and the back end only waits on MEM.
+    // EX only adds its own multi-cycle ops (deep pipeline) to
+    // MEM's ready: while EX holds, MEM and WB keep advancing and
+    // EX-MEM takes a bubble. An empty queue sends a bubble down
+    // instead of holding the back end.
+    // A misaligned access holds MEM for its second transaction.
+    // ============================================================
+    always_comb begin
+        MEM_ready = MEM_DONE && ~(MEM_split && ~MEM_upper);
+        EX_ready  = MEM_ready && ~EX_busy;
+        ID_pop    = EX_ready && ~stallID && ~flushID;
+        redirect  = EX_ready && flushIF;
+        IF_push   = IF_BEAT && ~IF_drop;
+        EX_retire = EX_ready && EX_valid && ~stallEX && ~EX_interrupt_taken && ~EX_drop;
+    end
 
+    // ============================================================
+    // EX2: Branch Resolve and Registered Redirect (deep pipeline)
+    // ------------------------------------------------------------
+    // Every op leaving EX1 is registered with its forwarded
+    // operands and prediction; Branch_Unit compares and checks
+    // the prediction in EX2. A mispredict drops the op in EX1
+    // right away (its effects only reach pipeline registers and
+    // CSRs) and is registered alongside trap / mret redirects from
+    // EX1; the registered redirect steers fetch and kills the op
+    // that entered EX1 meanwhile, so the compare never reaches
+    // the stage handshake or the fetch request. WFI and the
+    // load-use bubble only hold the pipeline and stay immediate.
+    // ============================================================
+    generate
+        if (DEEP) begin : g_ex2_redirect
+            always_ff @(posedge clk or posedge rst) begin
+                if (rst) begin
+                    rdPending  <= 1'b0;
+                    rdTarget   <= 32'd0;
+                    br2Valid   <= 1'b0;
+                    br2Op      <= 5'd0;
+                    br2Func    <= 4'd0;
+                    br2Pc      <= 32'd0;
+                    br2Src1    <= 32'd0;
+                    br2Src2    <= 32'd0;
+                    br2Imm     <= 32'd0;
+                    br2PTaken  <= 1'b0;
+                    br2PTarget <= 32'd0;
+                end else if (EX_ready) begin
+                    rdPending  <= br2Wrong || (ctrFlushIF && ~stallEX);
+                    rdTarget   <= br2Wrong ? br2CTarget : ctrFTarget;
+                    br2Valid   <= EX_retire && ~ctrFlushIF;
+                    br2Op      <= EX_op;
+                    br2Func    <= EX_func;
+                    br2Pc      <= EX_pc;
+                    br2Src1    <= EX_Forward_rs1data;
+                    br2Src2    <= EX_Forward_rs2data;
+                    br2Imm     <= EX_Imm;
+                    br2PTaken  <= EX_pTaken;
+                    br2PTarget <= EX_pTarget;
+                end
+            end
+
+            Branch_Unit branchUnit (
+                .valid          (br2Valid           ),
+                .op             (br2Op              ),
+                .func           (br2Func            ),
+                .pc             (br2Pc              ),
+                .src1           (br2Src1            ),
+                .src2           (br2Src2            ),
+                .imm            (br2Imm             ),
+                .pTaken         (br2PTaken          ),
+                .pTarget        (br2PTarget         ),
+
+                .rTaken         (bpRTaken           ),
+                .bType          (bpBType            ),
+                .bTarget        (bpBTarget          ),
+                .wrongBranch    (br2Wrong           ),
+                .cTarget        (br2CTarget         )
+            );
+
+            // br2Valid is only set for an op that retired from EX1,
+            // and EX2 moves on EX_ready, so each op trains once
+            assign bpReady    = EX_ready && br2Valid;
+            assign bpPc       = br2Pc;
+
+            assign EX_kill    = rdPending;
+            assign EX_drop    = EX_kill || br2Wrong;
+            assign flushIF    = EX_kill || (ctrFlushIF && stallEX);
+            assign flushID    = EX_kill || (ctrFlushID && stallEX);
+            assign flushEX    = EX_kill || (ctrFlushEX && ~ctrFlushIF);
+            assign EX_fTarget = rdPending ? rdTarget : ctrFTarget;
+
+            // the op in EX1 behind a mispredict may still stall for
+            // a cycle, but takes no trap and writes no CSR
+            assign EX_interrupt_taken  = ctrIntTaken  && ~br2Wrong;
+            assign EX_interrupt_return = ctrIntReturn && ~br2Wrong;
+            assign EX_interrupt_chain  = ctrIntChain  && ~br2Wrong;
+            assign EX_csrEn            = ctrCsrEn     && ~br2Wrong;
+        end else begin : g_ex_redirect
+            assign rdPending  = 1'b0;
+            assign rdTarget   = 32'd0;
+            assign br2Wrong   = 1'b0;
+            assign br2CTarget = 32'd0;
+            assign EX_kill    = 1'b0;
+            assign EX_drop    = 1'b0;
+            assign flushIF    = ctrFlushIF;
+            assign flushID    = ctrFlushID;
+            assign flushEX    = ctrFlushEX;
+            assign EX_fTarget = ctrFTarget;
+
+            assign EX_interrupt_taken  = ctrIntTaken;
+            assign EX_interrupt_return = ctrIntReturn;
+            assign EX_interrupt_chain  = ctrIntChain;
+            assign EX_csrEn            = ctrCsrEn;
+
+            // train on retiring ops only: a held, killed or
+            // interrupted op is trained when (if) it retires
+            assign bpReady    = EX_retire;
+            assign bpPc       = EX_pc;
+            assign bpBType    = EX_bType;
+            assign bpRTaken   = EX_rTaken;
+            assign bpBTarget  = EX_bTarget;
+        end
+    endgenerate
 
+    // ============================================================
+    // EX Multi-Cycle Ops (deep pipeline)
+    // ------------------------------------------------------------
+    // FPU takes two EX cycles. The first cycle captures the
+    // forwarded operands into its stage register (exLoad); exStep
+    // marks the second. MUL does not hold EX: it is pipelined
+    // alongside EX-MEM-WB (see Multiplier).
+    // ============================================================
+    always_comb begin
+        EX_mul  = DEEP && (EX_op == `OP_RM_TYPE) && EX_is_mtype;
+        EX_long = DEEP && EX_valid && ~EX_kill && (EX_op == `OP_FTYPE);
+        EX_busy = EX_long && ~exStep;
+        exLoad  = EX_busy;
+    end
 
+    always_ff @(posedge clk or posedge rst) begin
+        if (rst)           exStep <= 1'b0;
+        else if (EX_ready) exStep <= 1'b0;
+        else if (EX_busy)  exStep <= 1'b1;
+    end
 
     // ============================================================
     // Hazard Detection
@@ -154,7 +395,9 @@ module CPU (
         .EX_rd               (EX_rd               ),
         .EX_rs1              (EX_rs1              ),
         .EX_rs2              (EX_rs2              ),
+        .EX_mul              (EX_mul              ),
         .MEM_op              (MEM_op              ),
+        .MEM_mul             (MEM_mul             ),
         .MEM_rd              (MEM_rd              ),
         .WB_op               (WB_op               ),
         .WB_rd               (WB_rd               ),
@@ -173,19 +416,19 @@ module CPU (
     // ------------------------------------------------------------
     // Branch Predictor
     // ------------------------------------------------------------
-    Branch_Predictor branchPredictor (
+    Branch_Predictor #(
+        .REG_LOOKUP         (DEEP               )
+    ) branchPredictor (
         .clk                (clk                ),
         .rst                (rst                ),
-        .IF_DONE            (IF_DONE            ),
-        .MEM_DONE           (MEM_DONE           ),
-        .DMA_interrupt      (DMA_interrupt      ),
-	    .WTO_interrupt      (WTO_interrupt      ),
+        .EX_ready           (bpReady            ),
 
         .IF_PC              (IF_pc              ),
-        .EX_PC              (EX_pc              ),
-        .EX_bType           (EX_bType           ),
-        .EX_rTaken          (EX_rTaken          ),
-        .EX_bTarget         (EX_bTarget         ),
+        .IF_nextPC          (IF_nextPc          ),
+        .EX_PC              (bpPc               ),
+        .EX_bType           (bpBType            ),
+        .EX_rTaken          (bpRTaken           ),
+        .EX_bTarget         (bpBTarget          ),
 
         .IF_pTaken          (IF_pTaken          ),
         .IF_pTarget         (IF_pTarget         )
@@ -199,54 +442,74 @@ module CPU (
         .clk                (clk                ),
         .rst                (rst                ),
         .IF_DONE            (IF_DONE            ),
-        .MEM_DONE           (MEM_DONE           ),
+        .IF_BEAT            (IF_BEAT            ),
 
-        .stall              (stallIF            ),
-        .flush              (flushIF            ),
+        .redirect           (redirect           ),
         .pTaken             (IF_pTaken          ),
         .pTarget            (IF_pTarget         ),
         .fTarget            (EX_fTarget         ),
 
-        .pc                 (IF_pc              )
+        .pc                 (IF_pc              ),
+        .nextPc             (IF_nextPc          ),
+        .drop               (IF_drop            )
     );
 
     // ------------------------------------------------------------
     // Instruction Memory (IM) Interface
     // ------------------------------------------------------------
+    // A request is a burst to the end of the aligned 4-word block
+    // and is only raised once the queue has room for every beat,
+    // so RREADY never has to stall. IF_VALIDn only changes between
+    // fetches and the room only grows until AR is accepted, so a
+    // request, once raised, stays stable until the wrapper
+    // completes it.
     always_ff @(posedge clk or posedge rst) begin
-        if (rst) begin
-            IF_VALIDn <= 1'b0;
-        end else if (IF_DONE && ~MEM_DONE) begin
-            IF_VALIDn <= 1'b1;
-        end else if (IF_DONE && MEM_DONE)begin
-            IF_VALIDn <= EX_IF_VALIDn;
-        end
+        if (rst)           fetchOff <= 1'b0;
+        else if (EX_ready) fetchOff <= EX_IF_VALIDn;
+    end
+
+    always_ff @(posedge clk or posedge rst) begin
+        if (rst)          IF_VALIDn <= 1'b0;
+        else if (IF_DONE) IF_VALIDn <= (EX_ready) ? EX_IF_VALIDn : fetchOff;
     end
 
     always_comb begin
-        IF_VALID = ~IF_VALIDn;
-        IF_ADDR = IF_pc;
+        IF_LEN   = {2'd0, ~IF_pc[3:2]};
+        IF_VALID = ~IF_VALIDn && (IFQ_room > IF_LEN);
+        IF_ADDR  = IF_pc;
     end
 
     // ------------------------------------------------------------
     // IF-ID Pipeline Register
     // ------------------------------------------------------------
-    IFID ifid (
+    IFID #(
+        .DEPTH              (8                  )
+    ) ifid (
         .clk                (clk                ),
         .rst                (rst                ),
-        .IF_DONE            (IF_DONE            ),
-        .MEM_DONE           (MEM_DONE           ),
 
-        .stall              (stallID            ),
-        .flush              (flushID            ),
+        .push               (IF_push            ),
+        .pop                (ID_pop             ),
+        .pop2               (ID_fuse            ),
+        .flush              (EX_ready && flushID),
 
         .IF_pc              (IF_pc              ),
         .IF_inst            (IF_RdData          ),
         .IF_pTaken          (IF_pTaken          ),
+        .IF_pTarget         (IF_pTarget         ),
 
+        .room               (IFQ_room           ),
+        .ID_valid           (ID_valid           ),
         .ID_pc              (ID_pc              ),
         .ID_inst            (ID_inst            ),
-        .ID_pTaken          (ID_pTaken          )
+        .ID_pTaken          (ID_pTaken          ),
+        .ID_pTarget         (ID_pTarget         ),
+
+        .ID_valid2          (ID_valid2          ),
+        .ID_pc2             (ID_pc2             ),
+        .ID_inst2           (ID_inst2           ),
+        .ID_pTaken2         (ID_pTaken2         ),
+        .ID_pTarget2        (ID_pTarget2        )
     );
 
 
@@ -266,28 +529,59 @@ module CPU (
         .ID_use_rs1          (ID_use_rs1          ),
         .ID_use_rs2          (ID_use_rs2          ),
         .ID_use_frs1         (ID_use_frs1         ),
-        .ID_use_frs2         (ID_use_frs2         )
+        .ID_use_frs2         (ID_use_frs2         ),
+
+        .ID_dec1Op           (ID_dec1Op           ),
+        .ID_dec1Rd           (ID_dec1Rd           ),
+        .ID_dec1Rs2          (ID_dec1Rs2          ),
+        .ID_dec1Func         (ID_dec1Func         ),
+        .ID_dec1IsM          (ID_dec1IsM          ),
+        .ID_dec2Op           (ID_dec2Op           ),
+        .ID_dec2Rd           (ID_dec2Rd           ),
+        .ID_dec2Rs1          (ID_dec2Rs1          ),
+        .ID_dec2Rs2          (ID_dec2Rs2          ),
+        .ID_dec2Func         (ID_dec2Func         ),
+        .ID_dec2IsM          (ID_dec2IsM          ),
+        .ID_valid2           (ID_valid2           ),
+        .ID_pTaken           (ID_pTaken           ),
+        .ID_fuse             (ID_fuse             ),
+        .ID_fuseType         (ID_fuseType         )
     );
 
 
     // ------------------------------------------------------------
-    // Instruction Decoder
+    // Instruction Decoder (head and fusion partner)
     // ------------------------------------------------------------
     Decoder Decoder (
         .inst               (ID_inst             ),
 
-        .rs1_index          (ID_rs1              ),
-        .rs2_index          (ID_rs2              ),
-        .rd_index           (ID_rd               ),
-        .opcode             (ID_op               ),
-        .func               (ID_func             ),
-        .is_mtype           (ID_is_mtype         ),
+        .rs1_index          (ID_dec1Rs1          ),
+        .rs2_index          (ID_dec1Rs2          ),
+        .rd_index           (ID_dec1Rd           ),
+        .opcode             (ID_dec1Op           ),
+        .func               (ID_dec1Func         ),
+        .is_mtype           (ID_dec1IsM          ),
         .is_fsub            (ID_is_fsub          ),
         .csrIdx             (ID_csrIdx           ),
         .WFI                (ID_WFI              ),
         .MRET               (ID_MRET             )
     );
 
+    Decoder Decoder2 (
+        .inst               (ID_inst2            ),
+
+        .rs1_index          (ID_dec2Rs1          ),
+        .rs2_index          (ID_dec2Rs2          ),
+        .rd_index           (ID_dec2Rd           ),
+        .opcode             (ID_dec2Op           ),
+        .func               (ID_dec2Func         ),
+        .is_mtype           (ID_dec2IsM          ),
+        .is_fsub            (                    ),
+        .csrIdx             (                    ),
+        .WFI                (                    ),
+        .MRET               (                    )
+    );
+
     // ------------------------------------------------------------
     // Immediate Generator
     // ------------------------------------------------------------
@@ -296,6 +590,71 @@ module CPU (
         .imm                (ID_Imm              )
     );
 
+    Immediate_Generator immGenerator2 (
+        .inst               (ID_inst2            ),
+        .imm                (ID_Imm2             )
+    );
+
+    // ------------------------------------------------------------
+    // Fused Op Fields
+    // ------------------------------------------------------------
+    // A fused pair issues as one internal op built from the two
+    // decoded entries (see Controller_ID). It takes the second
+    // entry's pc and prediction: the call and cmp-br jump from
+    // there, and the predictor trains on the same pc it sees at
+    // fetch.
+    always_comb begin
+        ID_rs1      = ID_dec1Rs1;
+        ID_rs2      = ID_dec1Rs2;
+        ID_rd       = ID_dec1Rd;
+        ID_op       = ID_dec1Op;
+        ID_func     = ID_dec1Func;
+        ID_is_mtype = ID_dec1IsM;
+        if (ID_fuse) begin
+            ID_is_mtype = 1'b0;
+            case (ID_fuseType)
+                `FUSE_LUI: begin
+                    ID_rs1 = 5'd0;
+                    ID_rs2 = 5'd0;
+                end
+                `FUSE_CALL: begin
+                    ID_op  = `OP_JAL;
+                    ID_rd  = ID_dec2Rd;
+                    ID_rs1 = 5'd0;
+                    ID_rs2 = 5'd0;
+                end
+                `FUSE_SHADD: begin
+                    ID_op  = `OP_RM_TYPE;
+                    ID_rs2 = (ID_dec2Rs1 == ID_dec1Rd) ? ID_dec2Rs2 : ID_dec2Rs1;
+                    case (ID_dec1Rs2[1:0])                      // slli shamt
+                        2'd1:    ID_func = `FUNC_SH1ADD;
+                        2'd2:    ID_func = `FUNC_SH2ADD;
+                        default: ID_func = `FUNC_SH3ADD;
+                    endcase
+                end
+                `FUSE_CMPBR: begin
+                    ID_op   = `OP_CMP_BR;
+                    ID_func = {ID_dec2Func[3:1], ID_dec1Func[1]};  // branch funct3, unsigned compare
+                end
+            endcase
+        end
+    end
+
+    always_comb begin
+        ID_opPc      = ID_fuse ? ID_pc2      : ID_pc;
+        ID_opPTaken  = ID_fuse ? ID_pTaken2  : ID_pTaken;
+        ID_opPTarget = ID_fuse ? ID_pTarget2 : ID_pTarget;
+        ID_opImm     = ID_Imm;
+        if (ID_fuse) begin
+            case (ID_fuseType)
+                `FUSE_LUI:   ID_opImm = ID_Imm + ID_Imm2;
+                `FUSE_CALL:  ID_opImm = ID_Imm + ID_Imm2 - 32'd4;
+                `FUSE_CMPBR: ID_opImm = ID_Imm2;
+                default:     ID_opImm = ID_Imm;
+            endcase
+        end
+    end
+
 
     // ------------------------------------------------------------
     // Register File (Integer and Float)
@@ -332,12 +691,12 @@ module CPU (
         // input
         .clk                (clk                 ),
         .rst                (rst                 ),
-        .IF_DONE            (IF_DONE             ),
-        .MEM_DONE           (MEM_DONE            ),
+        .ready              (EX_ready            ),
         .stall              (stallEX             ),
         .flush              (flushEX             ),
 
-        .ID_pc              (ID_pc               ),
+        .ID_valid           (ID_valid            ),
+        .ID_pc              (ID_opPc             ),
         .ID_op              (ID_op               ),
         .ID_func            (ID_func             ),
         .ID_rd              (ID_rd               ),
@@ -348,11 +707,14 @@ module CPU (
         .ID_csrIdx          (ID_csrIdx           ),
         .ID_rs1_data        (ID_Forward_rs1data  ),
         .ID_rs2_data        (ID_Forward_rs2data  ),
-        .ID_Imm             (ID_Imm              ),
-        .ID_pTaken          (ID_pTaken           ),
+        .ID_Imm             (ID_opImm            ),
+        .ID_pTaken          (ID_opPTaken         ),
+        .ID_pTarget         (ID_opPTarget        ),
         .ID_WFI             (ID_WFI              ),
         .ID_MRET            (ID_MRET             ),
+        .ID_fused           (ID_fuse             ),
 
+        .EX_valid           (EX_valid            ),
         .EX_pc              (EX_pc               ),
         .EX_op              (EX_op               ),
         .EX_func            (EX_func             ),
@@ -366,9 +728,10 @@ module CPU (
         .EX_rs2_data        (EX_rs2_data         ),
         .EX_Imm             (EX_Imm              ),
         .EX_pTaken          (EX_pTaken           ),
+        .EX_pTarget         (EX_pTarget          ),
         .EX_WFI             (EX_WFI              ),
-        .EX_MRET            (EX_MRET             )
-
+        .EX_MRET            (EX_MRET             ),
+        .EX_fused           (EX_fused            )
     );
 
 
@@ -379,7 +742,11 @@ module CPU (
     // ------------------------------------------------------------
     // EX Controller
     // ------------------------------------------------------------
-    Controller_EX ctrex (
+    Controller_EX #(
+        .EX2_BRANCH          (DEEP                )
+    ) ctrex (
+        .EX_valid            (EX_valid            ),
+        .EX_kill             (EX_kill             ),
         .EX_op               (EX_op               ),
         .EX_rd               (EX_rd               ),
         .EX_rs1              (EX_rs1              ),
@@ -387,12 +754,16 @@ module CPU (
         .EX_func             (EX_func             ),
         .EX_bFlag            (EX_aluOut[0]        ),
         .EX_pTaken           (EX_pTaken           ),
+        .EX_pTarget          (EX_pTarget          ),
+        .EX_bTarget          (EX_bTarget          ),
         .loadStall           (loadStall           ),
         .EX_cTarget          (EX_cTarget          ),
         .EX_pc               (EX_pc               ),
         .EX_WFI              (EX_WFI              ),
         .EX_MRET             (EX_MRET             ),
+        .EX_fused            (EX_fused            ),
         .EX_MIE              (EX_MIE              ),
+        .EX_MPIE             (EX_MPIE             ),
         .EX_MEIE             (EX_MEIE             ),
         .EX_MTIE             (EX_MTIE             ),
         .EX_MEIP             (EX_MEIP             ),
@@ -406,22 +777,21 @@ module CPU (
         .EX_aluSelA          (EX_aluSelA          ),
         .EX_aluSelB          (EX_aluSelB          ),
         .EX_jbSelA           (EX_jbSelA           ),
-        .EX_csrEn            (EX_csrEn            ),
+        .EX_csrEn            (ctrCsrEn            ),
         .EX_csrSelB          (EX_csrSelB          ),
-        .EX_interrupt_taken  (EX_interrupt_taken  ),
-        .EX_interrupt_return (EX_interrupt_return ),
-        .EX_flush_pc         (EX_fTarget          ),
+        .EX_interrupt_taken  (ctrIntTaken         ),
+        .EX_interrupt_return (ctrIntReturn        ),
+        .EX_interrupt_chain  (ctrIntChain         ),
+        .EX_cause            (EX_cause            ),
+        .EX_flush_pc         (ctrFTarget          ),
         .EX_mepc             (EX_mepc             ),
         .EX_IF_VALIDn        (EX_IF_VALIDn        ),
 
-        .stallIF             (stallIF             ),
         .stallID             (stallID             ),
         .stallEX             (stallEX             ),
-        .stallCSR            (stallCSR            ),
-        .flushIF             (flushIF             ),
-        .flushID             (flushID             ),
-        .flushEX             (flushEX             ),
-        .flushCSR            (flushCSR            )
+        .flushIF             (ctrFlushIF          ),
+        .flushID             (ctrFlushID          ),
+        .flushEX             (ctrFlushEX          )
     );
 
 
@@ -432,14 +802,14 @@ module CPU (
         case (EX_fwdA)
             2'd0: EX_Forward_rs1data = EX_rs1_data;
             2'd1: EX_Forward_rs1data = MEM_aluOut;
-            2'd2: EX_Forward_rs1data = WB_wbData;
+            2'd2: EX_Forward_rs1data = WB_fwdData;
             default: EX_Forward_rs1data = 32'd0;
         endcase
 
         case (EX_fwdB)
             2'd0: EX_Forward_rs2data = EX_rs2_data;
             2'd1: EX_Forward_rs2data = MEM_aluOut;
-            2'd2: EX_Forward_rs2data = WB_wbData;
+            2'd2: EX_Forward_rs2data = WB_fwdData;
             default: EX_Forward_rs2data = 32'd0;
         endcase
     end
@@ -462,7 +832,9 @@ module CPU (
     // ------------------------------------------------------------
     // ALU
     // ------------------------------------------------------------
-    ALU ALU (
+    ALU #(
+        .HAS_MUL            (!DEEP               )
+    ) ALU (
         .src1               (EX_ALU_src1         ),
         .src2               (EX_ALU_src2         ),
         .opcode             (EX_op               ),
@@ -476,7 +848,12 @@ module CPU (
     // ------------------------------------------------------------
     // Floating-Point Unit
     // ------------------------------------------------------------
-    FPU FPU (
+    FPU #(
+        .PIPE               (DEEP                )
+    ) FPU (
+        .clk                (clk                 ),
+        .rst                (rst                 ),
+        .load               (exLoad              ),
         .src1               (EX_Forward_rs1data  ),
         .src2               (EX_Forward_rs2data  ),
         .sub                (EX_is_fsub          ),
@@ -485,30 +862,60 @@ module CPU (
     );
 
 
+    // ------------------------------------------------------------
+    // Multiplier (deep pipeline: EX / MEM / WB, ALU keeps MUL otherwise)
+    // ------------------------------------------------------------
+    generate
+        if (DEEP) begin : g_mul
+            Multiplier Multiplier (
+                .clk        (clk                 ),
+                .rst        (rst                 ),
+                .advance    (MEM_ready           ),
+                .valid      (EX_retire && EX_mul ),
+                .src1       (EX_ALU_src1         ),
+                .src2       (EX_ALU_src2         ),
+                .func       (EX_func             ),
+
+                .memValid   (MEM_mul             ),
+                .wbValid    (WB_mul              ),
+                .mulOut     (mulOut              )
+            );
+        end else begin : g_no_mul
+            assign MEM_mul = 1'b0;
+            assign WB_mul  = 1'b0;
+            assign mulOut  = 32'd0;
+        end
+    endgenerate
+
+
     // ------------------------------------------------------------
     // CSR Register File
     // ------------------------------------------------------------
-    CSR_File CSR_File (
+    CSR_File #(
+        .HART_ID            (32'(HART_ID)       )
+    ) CSR_File (
         .clk                (clk                ),
         .rst                (rst                ),
-        .IF_DONE            (IF_DONE            ),
-        .MEM_DONE           (MEM_DONE           ),
+        .ready              (EX_ready           ),
+        .retire             (EX_retire          ),
+        .retire2            (EX_fused           ),
 
         .DMA_interrupt      (DMA_interrupt      ),
 	    .WTO_interrupt      (WTO_interrupt      ),
         .interrupt_taken    (EX_interrupt_taken ),
         .interrupt_return   (EX_interrupt_return),
+        .interrupt_chain    (EX_interrupt_chain ),
+        .interrupt_cause    (EX_cause           ),
         .EX_mepc            (EX_mepc            ),
 
         .enable             (EX_csrEn           ),
-        .stall              (stallCSR           ),
-        .flush              (flushCSR           ),
         .func3              (EX_func[3:1]       ),
         .csrIdx             (EX_csrIdx          ),
         .src2               (EX_CSR_src2        ),
 
         .csrOut             (csrOut             ),
         .MIE                (EX_MIE             ),
+        .MPIE               (EX_MPIE            ),
         .MEIE               (EX_MEIE            ),
         .MTIE               (EX_MTIE            ),
         .MEIP               (EX_MEIP            ),
@@ -523,7 +930,7 @@ module CPU (
     // ------------------------------------------------------------
     always_comb begin
         EX_aluOut = (EX_op == `OP_FTYPE) ? fpuOut :
-                    (EX_op == `OP_CSR    ? csrOut : aluOut);
+                    (EX_op == `OP_CSR)   ? csrOut : aluOut;
     end
 
 
@@ -541,8 +948,8 @@ module CPU (
     EXMEM exmem (
         .clk                (clk                 ),
         .rst                (rst                 ),
-        .IF_DONE            (IF_DONE             ),
-        .MEM_DONE           (MEM_DONE            ),
+        .ready              (MEM_ready           ),
+        .flush              (~EX_ready || EX_interrupt_taken || EX_drop),
 
         .EX_op              (EX_op               ),
         .EX_func            (EX_func             ),
@@ -568,16 +975,46 @@ module CPU (
     always_ff @(posedge clk or posedge rst) begin
         if (rst) begin
             MEM_VALID <= 1'b0;
-        end else if (~IF_DONE && MEM_DONE) begin
-            MEM_VALID <= 1'b0;
-        end else if (IF_DONE && MEM_DONE)begin
-            MEM_VALID <= (  ((EX_op == `OP_I_LOAD) || (EX_op == `OP_FLW)) && (EX_rd != 5'd0)  ) || (EX_op == `OP_S_TYPE) || (EX_op == `OP_FSW);
+        end else if (MEM_ready) begin
+            MEM_VALID <= EX_ready && ~EX_interrupt_taken && ~EX_drop && (
+                         (  ((EX_op == `OP_I_LOAD) || (EX_op == `OP_FLW)) && (EX_rd != 5'd0)  ) || (EX_op == `OP_S_TYPE) || (EX_op == `OP_FSW) || (EX_op == `OP_FENCE) );
         end
     end
 
     always_comb begin
-        MEM_ADDR = MEM_aluOut;
-        MEM_WEB  = (MEM_op == `OP_S_TYPE || MEM_op == `OP_FSW);
+        MEM_ADDR  = MEM_upper ? {MEM_aluOut[31:2] + 30'd1, 2'b00} : MEM_aluOut;
+        MEM_WEB   = (MEM_op == `OP_S_TYPE || MEM_op == `OP_FSW);
+        MEM_FENCE = (MEM_op == `OP_FENCE);
+    end
+
+    // ------------------------------------------------------------
+    // Misaligned Access Split
+    // ------------------------------------------------------------
+    // A half/word that crosses a word boundary is issued as two
+    // aligned transactions: the addressed word, then the next one.
+    // MEM stays valid across both and only becomes ready after the
+    // second, so the pipeline stalls for the extra beat alone. The
+    // first read word is kept for the Load Filter to merge.
+    // Device registers (0x1xxx_xxxx) are never split: a second
+    // access would read or write the next register as a side
+    // effect, so a misaligned device access only reaches the
+    // bytes of the addressed word.
+    always_comb begin
+        MEM_split = MEM_VALID && (MEM_aluOut[31:28] != 4'h1) &&
+                    (MEM_op == `OP_I_LOAD || MEM_op == `OP_FLW || MEM_op == `OP_S_TYPE || MEM_op == `OP_FSW) && (
+                    ((MEM_func3[1:0] == 2'b10) && (MEM_aluOut[1:0] != 2'b00)) ||
+                    ((MEM_func3[1:0] == 2'b01) && (MEM_aluOut[1:0] == 2'b11)) );
+        MEM_RdWord = MEM_split ? MEM_RdLo : MEM_RdData;
+    end
+
+    always_ff @(posedge clk or posedge rst) begin
+        if (rst) begin
+            MEM_upper <= 1'b0;
+            MEM_RdLo  <= 32'd0;
+        end else if (MEM_DONE && MEM_split) begin
+            MEM_upper <= ~MEM_upper;
+            if (~MEM_upper) MEM_RdLo <= MEM_RdData;
+        end
     end
 
     // ------------------------------------------------------------
@@ -588,6 +1025,7 @@ module CPU (
         .opcode             (MEM_op               ),
         .func3              (MEM_func3            ),
         .storeData          (MEM_rs2_data         ),
+        .upper              (MEM_upper            ),
 
         .memData            (MEM_WrData           ),
         .memWriteMask       (MEM_STRB             )
@@ -600,20 +1038,21 @@ module CPU (
     MEMWB memwb (
         .clk                (clk                ),
         .rst                (rst                ),
-        .IF_DONE            (IF_DONE            ),
-        .MEM_DONE           (MEM_DONE           ),
+        .ready              (MEM_ready          ),
 
         .MEM_op             (MEM_op             ),
         .MEM_rd             (MEM_rd             ),
         .MEM_func3          (MEM_func3          ),
         .MEM_aluOut         (MEM_aluOut         ),
-        .MEM_ReadData       (MEM_RdData         ),
+        .MEM_ReadData       (MEM_RdWord         ),
+        .MEM_ReadDataHi     (MEM_RdData         ),
 
         .WB_op              (WB_op              ),
         .WB_rd              (WB_rd              ),
         .WB_func3           (WB_func3           ),
         .WB_aluOut          (WB_aluOut          ),
-        .WB_ReadData        (WB_ReadData        )
+        .WB_ReadData        (WB_ReadData        ),
+        .WB_ReadDataHi      (WB_ReadDataHi      )
     );
 
 
@@ -638,6 +1077,7 @@ module CPU (
     Load_Filter loadFilter (
         .byteOffset         (WB_aluOut[1:0]      ),
         .memData            (WB_ReadData         ),
+        .memDataHi          (WB_ReadDataHi       ),
         .func3              (WB_func3            ),
 
         .loadData           (WB_loadData         )
@@ -646,8 +1086,12 @@ module CPU (
     // ------------------------------------------------------------
     // Writeback Data Selection
     // ------------------------------------------------------------
+    // The MUL sum only goes to the register file and WB->ID; a
+    // MUL user never reaches EX while the MUL is in WB (ID stall),
+    // so WB->EX forwarding leaves the sum off its path.
     always_comb begin
-        WB_wbData = WB_wbSel ? WB_loadData : WB_aluOut;
+        WB_fwdData = WB_wbSel ? WB_loadData : WB_aluOut;
+        WB_wbData  = WB_mul   ? mulOut      : WB_fwdData;
     end
 
 
@@ -1,24 +1,28 @@
-module CSR_File (
+module CSR_File #(
+    parameter logic [31:0] HART_ID = 32'd0
+) (
     input  logic        clk,
     input  logic        rst,
-    input  logic        IF_DONE,
-    input  logic        MEM_DONE,
+    input  logic        ready,
+    input  logic        retire,
+    input  logic        retire2,    // retiring op is a fused pair
 
     input  logic        DMA_interrupt,
     input  logic        WTO_interrupt,
     input  logic        interrupt_taken,
     input  logic        interrupt_return,
+    input  logic        interrupt_chain,
+    input  logic [3:0]  interrupt_cause,
     input  logic [31:0] EX_mepc,
 
     input  logic        enable,
-    input  logic        stall,
-    input  logic        flush,
     input  logic [2:0]  func3,
     input  logic [11:0] csrIdx,
     input  logic [31:0] src2,
 
     output logic [31:0] csrOut,
     output logic        MIE,
+    output logic        MPIE,
     output logic        MEIE,
     output logic        MTIE,
     output logic        MEIP,
@@ -36,6 +40,7 @@ module CSR_File (
     logic [31:0] mie;
     logic [31:0] mtvec;
     logic [31:0] mepc;
+    logic [31:0] mcause;
     logic [31:0] mip;
 
     // ============================================================
@@ -61,7 +66,9 @@ module CSR_File (
             `CSR_MIE:      rd_data = mie;
             `CSR_MTVEC:    rd_data = mtvec;
             `CSR_MEPC:     rd_data = mepc;
+            `CSR_MCAUSE:   rd_data = mcause;
             `CSR_MIP:      rd_data = mip;
+            `CSR_MHARTID:  rd_data = HART_ID;
             default:       rd_data = 32'd0;
         endcase
     end
@@ -96,8 +103,9 @@ module CSR_File (
         if (rst) begin
             mstatus <= 32'd0;
             mie     <= 32'd0;
-            mtvec   <= 32'h0001_0000;
+            mtvec   <= `MTVEC_BASE;
             mepc    <= 32'd0;
+            mcause  <= 32'd0;
             mip     <= 32'd0;
 
             cycle   <= 64'd0;
@@ -109,21 +117,21 @@ module CSR_File (
             // -------------------------------
             cycle <= cycle + 64'd1;
 
-            if (IF_DONE && MEM_DONE) begin
-                if      (stall) instret <= instret;
-                else if (flush) instret <= instret - 64'd1;
-                else            instret <= instret + 64'd1;
-
+            if (retire) instret <= instret + (retire2 ? 64'd2 : 64'd1);
 
+            if (ready) begin
                 // -------------------------------
                 // CSR instruction write
+                // (dropped when the instruction is
+                //  interrupted; it re-executes later)
                 // -------------------------------
-                if (enable) begin
+                if (enable && ~interrupt_taken) begin
                     unique case (csrIdx)
                         `CSR_MSTATUS: mstatus <= {19'd0, wr_data[12:11], 3'b0, wr_data[7], 3'b0, wr_data[3], 3'b0};
                         `CSR_MIE    : mie     <= {20'd0, wr_data[11], 3'b0, wr_data[7], 7'b0};
-                        `CSR_MTVEC  : mtvec   <= mtvec;
+                        `CSR_MTVEC  : mtvec   <= {mtvec[31:2], 1'b0, wr_data[0]};
                         `CSR_MEPC   : mepc    <= {wr_data[31:2], 2'd0};
+                        `CSR_MCAUSE : mcause  <= {wr_data[31], 27'd0, wr_data[3:0]};
                         `CSR_MIP    : mip     <= 32'b0;
                         default     :         ;
                     endcase
@@ -137,6 +145,17 @@ module CSR_File (
                     mstatus <= {19'd0, 2'b11, 3'd0, mstatus[3], 3'd0,    1'b0   , 3'd0};
                     mip     <= 32'd0;
                     mepc    <= EX_mepc;
+                    mcause  <= {1'b1, 27'd0, interrupt_cause};
+                end
+                // -------------------------------
+                // Tail-Chain (mret straight into the
+                // next pending handler; mepc and
+                // mstatus are already what the
+                // return-then-trap pair would leave)
+                // -------------------------------
+                else if (interrupt_chain) begin
+                    mip     <= 32'd0;
+                    mcause  <= {1'b1, 27'd0, interrupt_cause};
                 end
                 // -------------------------------
                 // Interrupt Return
@@ -146,26 +165,31 @@ module CSR_File (
                     mstatus <= {19'd0, 2'b11, 3'd0,    1'b1   , 3'd0, mstatus[7], 3'd0};
                     mip     <= 32'd0;
                 end
-                // -------------------------------
-                // Interrupt
-                // -------------------------------
-                mip[7]  <= WTO_interrupt;
-                mip[11] <= DMA_interrupt;
             end
+
+            // -------------------------------
+            // Interrupt (sampled every cycle, so a
+            // line that rises or drops while the
+            // back end is held is seen on release,
+            // e.g. by a tail-chaining mret)
+            // -------------------------------
+            mip[7]  <= WTO_interrupt;
+            mip[11] <= DMA_interrupt;
         end
     end
 
     // ============================================================
-    // Combinational Outputs and Instret Decrement
+    // Combinational Outputs
     // ============================================================
     assign MIE         = mstatus[3];
+    assign MPIE        = mstatus[7];
     assign MEIE        = mie[11];
     assign MTIE        = mie[7];
     assign MEIP        = mip[11];
     assign MTIP        = mip[7];
     assign MTVEC       = mtvec;
     assign MEPC        = mepc;
-    assign instret_out = instret - 64'd2;
+    assign instret_out = instret;
 
 
 endmodule
@@ -1,4 +1,8 @@
-module Controller_EX (
+module Controller_EX #(
+    parameter bit EX2_BRANCH = 1'b0     // 1: Branch_Unit resolves branches in EX2
+) (
+    input logic         EX_valid,
+    input logic         EX_kill,
     input logic [4:0]   EX_op,
     input logic [4:0]   EX_rd,
     input logic [4:0]   EX_rs1,
@@ -6,12 +10,16 @@ module Controller_EX (
     input logic [3:0]   EX_func,
     input logic         EX_bFlag,
     input logic         EX_pTaken,
+    input logic [31:0]  EX_pTarget,
+    input logic [31:0]  EX_bTarget,
     input logic         loadStall,
     input logic [31:0]  EX_cTarget,
     input logic [31:0]  EX_pc,
     input logic         EX_WFI,
     input logic         EX_MRET,
+    input logic         EX_fused,
     input logic         EX_MIE,
+    input logic         EX_MPIE,
     input logic         EX_MEIE,
     input logic         EX_MTIE,
     input logic         EX_MEIP,
@@ -29,25 +37,31 @@ module Controller_EX (
     output logic        EX_csrSelB,
     output logic        EX_interrupt_taken,
     output logic        EX_interrupt_return,
+    output logic        EX_interrupt_chain,
+    output logic [3:0]  EX_cause,
     output logic [31:0] EX_flush_pc,
     output logic [31:0] EX_mepc,
     output logic        EX_IF_VALIDn,
 
-    output logic        stallIF,
     output logic        stallID,
     output logic        stallEX,
-    output logic        stallCSR,
     output logic        flushIF,
     output logic        flushID,
-    output logic        flushEX,
-    output logic        flushCSR
+    output logic        flushEX
 );
 
+    // ============================================================
+    // Local Signals
+    // ============================================================
+    logic        wrongBranch;
+    logic        EX_MEI, EX_MTI;
+    logic [31:0] EX_vector;
+
     // ============================================================
     // ALU operand selection
     // ============================================================
     assign EX_aluSelA = (EX_op == `OP_AUIPC || EX_op == `OP_JAL || EX_op == `OP_JALR);
-    assign EX_aluSelB = (EX_op == `OP_RM_TYPE || EX_op == `OP_B_TYPE) ? 1'b0 : 1'b1;
+    assign EX_aluSelB = (EX_op == `OP_RM_TYPE || EX_op == `OP_B_TYPE || EX_op == `OP_CMP_BR) ? 1'b0 : 1'b1;
 
     // ============================================================
     // Branch Prediction
@@ -55,52 +69,84 @@ module Controller_EX (
     // ------------------------------------------
     // Jump and Branch Control Signal
     // ------------------------------------------
-    assign EX_rTaken     = (EX_op == `OP_B_TYPE) ? EX_bFlag : (EX_op == `OP_JAL || EX_op == `OP_JALR);
+    // A fused cmp-br holds slt(u) in the flag; beq takes it on 0.
+    assign EX_rTaken     = (EX_op == `OP_B_TYPE)  ? EX_bFlag :
+                           (EX_op == `OP_CMP_BR)  ? EX_bFlag ^ (EX_func[3:1] == `BR_EQ) :
+                           (EX_op == `OP_JAL || EX_op == `OP_JALR);
     assign EX_jbSelA     = (EX_op == `OP_JALR);
-    assign EX_bType = (EX_op == `OP_B_TYPE) ? 2'b10 : (EX_op == `OP_JAL) ? 2'b01 : 2'b00;
+    assign EX_bType = (EX_op == `OP_B_TYPE || EX_op == `OP_CMP_BR) ? 2'b10 : (EX_op == `OP_JAL) ? 2'b01 : 2'b00;
 
     // ---------------------
     // Prediction Correction
     // ---------------------
-    assign wrongBranch   = (EX_rTaken ^ EX_pTaken);
+    // A taken prediction to the wrong target (stale BTB entry)
+    // is corrected the same way as a wrong direction. With
+    // EX2_BRANCH the correction comes from Branch_Unit instead.
+    assign wrongBranch   = ~EX2_BRANCH && ((EX_rTaken ^ EX_pTaken) || (EX_rTaken && EX_pTaken && (EX_pTarget != EX_bTarget)));
     assign EX_cTargetSel = !EX_rTaken & EX_pTaken;
 
     // ============================================================
     // CSR Enable
     // ============================================================
-    assign EX_csrEn   = (EX_op == `OP_CSR);
+    assign EX_csrEn   = (EX_op == `OP_CSR) && ~EX_kill;
     assign EX_csrSelB = EX_func[3];
 
+    // ============================================================
+    // Interrupt Cause and Vector
+    // ------------------------------------------------------------
+    // External (DMA) has priority over timer (WDT). In vectored
+    // mode the handler address is BASE + 4 * cause.
+    // ============================================================
+    assign EX_MEI    = EX_MEIP && EX_MEIE;
+    assign EX_MTI    = EX_MTIP && EX_MTIE;
+    assign EX_cause  = EX_MEI ? `CAUSE_MEI : `CAUSE_MTI;
+    assign EX_vector = (EX_MTVEC[0] == `MTVEC_VECTORED) ? {EX_MTVEC[31:2], 2'b00} + {26'd0, EX_cause, 2'b00}
+                                                         : {EX_MTVEC[31:2], 2'b00};
+
     // ============================================================
     // Interrupt and Flush / Stall
     // ============================================================
     always_comb begin
         EX_interrupt_taken  = 1'b0;
         EX_interrupt_return = 1'b0;
+        EX_interrupt_chain  = 1'b0;
         EX_flush_pc         = 32'd0;
         EX_mepc             = 32'd0;
         EX_IF_VALIDn        = 1'b0;
 
-        stallIF  = 1'b0;
         flushIF  = 1'b0;
         stallID  = 1'b0;
         flushID  = 1'b0;
         stallEX  = 1'b0;
         flushEX  = 1'b0;
-        stallCSR = 1'b0;
-        flushCSR = 1'b0;
+        // ---------------------
+        // Killed: wrong-path instruction behind
+        // a registered redirect (deep pipeline)
+        // ---------------------
+        if (EX_kill) begin
         // ---------------------
         // Interrupt Taken
         // ---------------------
-        if (EX_MIE && ((EX_MEIP && EX_MEIE)||(EX_MTIP && EX_MTIE))) begin
+        end else if (EX_valid && EX_MIE && (EX_MEI || EX_MTI)) begin
             EX_interrupt_taken  = 1'b1;
             flushIF             = 1'b1;
-            EX_flush_pc         = EX_MTVEC;
+            EX_flush_pc         = EX_vector;
+            flushID             = 1'b1;
+            flushEX             = 1'b1;
+            if (EX_WFI)        EX_mepc = EX_pc + 32'd4;
+            else if (EX_fused) EX_mepc = EX_pc - 32'd4;    // fused op carries the second pc
+            else               EX_mepc = EX_pc;
+        // ---------------------
+        // Tail-Chain: another interrupt is already
+        // pending, skip the round trip through mepc
+        // ---------------------
+        end else if (EX_MRET && EX_MPIE && (EX_MEI || EX_MTI)) begin
+            EX_interrupt_return = 1'b1;
+            EX_interrupt_chain  = 1'b1;
+            flushIF             = 1'b1;
+            EX_flush_pc         = EX_vector;
             flushID             = 1'b1;
             flushEX             = 1'b1;
-            flushCSR            = 1'b1;
-            if (EX_WFI) EX_mepc = EX_pc + 32'd4;
-            else        EX_mepc = EX_pc;
         // ---------------------
         // Interrupt Return
         // ---------------------
@@ -110,7 +156,6 @@ module Controller_EX (
             EX_flush_pc         = EX_MEPC;
             flushID             = 1'b1;
             flushEX             = 1'b1;
-            flushCSR            = 1'b1;
         // ---------------------
         // No Interrupt
         // ---------------------
@@ -123,15 +168,12 @@ module Controller_EX (
                 EX_IF_VALIDn = 1'b1;
                 flushID      = 1'b1;
                 stallEX      = 1'b1;
-                stallCSR     = 1'b1;
             // ---------------------
             // 2. Load Stall
             // ---------------------
             end else if (loadStall) begin
-                stallIF      = 1'b1;
                 stallID      = 1'b1;
                 flushEX      = 1'b1;
-                stallCSR     = 1'b1;
             // ---------------------
             // 3. MisPrediction
             // ---------------------
@@ -140,7 +182,6 @@ module Controller_EX (
                 EX_flush_pc  = EX_cTarget;
                 flushID      = 1'b1;
                 flushEX      = 1'b1;
-                flushCSR     = 1'b1;
                 end
             end
     end
@@ -1,20 +1,92 @@
 module Controller_ID (
-    input  logic [4:0] ID_op,
-    input  logic [4:0] ID_rs1,
-    input  logic [4:0] ID_rs2,
-    output logic       ID_use_rs1,
-    output logic       ID_use_rs2,
-    output logic       ID_use_frs1,
-    output logic       ID_use_frs2
+    input  logic [4:0]  ID_op,
+    input  logic [4:0]  ID_rs1,
+    input  logic [4:0]  ID_rs2,
+    output logic        ID_use_rs1,
+    output logic        ID_use_rs2,
+    output logic        ID_use_frs1,
+    output logic        ID_use_frs2,
+
+    // Macro-op fusion: decoded fields of the head and the entry
+    // behind it (before the pair is merged)
+    input  logic [4:0]  ID_dec1Op,
+    input  logic [4:0]  ID_dec1Rd,
+    input  logic [4:0]  ID_dec1Rs2,
+    input  logic [3:0]  ID_dec1Func,
+    input  logic        ID_dec1IsM,
+    input  logic [4:0]  ID_dec2Op,
+    input  logic [4:0]  ID_dec2Rd,
+    input  logic [4:0]  ID_dec2Rs1,
+    input  logic [4:0]  ID_dec2Rs2,
+    input  logic [3:0]  ID_dec2Func,
+    input  logic        ID_dec2IsM,
+    input  logic        ID_valid2,
+    input  logic        ID_pTaken,
+    output logic        ID_fuse,
+    output logic [1:0]  ID_fuseType
 );
 
     // ============================================================
     // ID Stage Register Usage
     // ============================================================
-    assign ID_use_rs1  = (ID_op == `OP_RM_TYPE || ID_op == `OP_I_ARITH || ID_op == `OP_I_LOAD || ID_op == `OP_JALR || ID_op == `OP_S_TYPE || ID_op == `OP_B_TYPE || ID_op == `OP_FLW || ID_op == `OP_FSW || ID_op == `OP_CSR);
-    assign ID_use_rs2  = (ID_op == `OP_RM_TYPE || ID_op == `OP_S_TYPE || ID_op == `OP_B_TYPE);
+    assign ID_use_rs1  = (ID_op == `OP_RM_TYPE || ID_op == `OP_I_ARITH || ID_op == `OP_I_LOAD || ID_op == `OP_JALR || ID_op == `OP_S_TYPE || ID_op == `OP_B_TYPE || ID_op == `OP_FLW || ID_op == `OP_FSW || ID_op == `OP_CSR || ID_op == `OP_CMP_BR);
+    assign ID_use_rs2  = (ID_op == `OP_RM_TYPE || ID_op == `OP_S_TYPE || ID_op == `OP_B_TYPE || ID_op == `OP_CMP_BR);
 
     assign ID_use_frs1 = (ID_op == `OP_FTYPE);
     assign ID_use_frs2 = (ID_op == `OP_FTYPE || ID_op == `OP_FSW);
 
+    // ============================================================
+    // Macro-Op Fusion
+    // ------------------------------------------------------------
+    // The head of the fetch queue and the entry behind it issue as
+    // one op when the first only produces a value the second
+    // consumes and overwrites (or, for cmp-br, tests against x0).
+    // The head must not be predicted taken so the pair is
+    // sequential; the fused op carries the second entry's pc and
+    // prediction and retires as two instructions.
+    // ============================================================
+    logic [4:0] rd1, rd2, rs1_2, rs2_2;
+    logic       isLui, isAuipc, isSlli, isSlt;
+    logic       isAddi, isJalr, isAdd, isBeqz;
+
+    always_comb begin
+        rd1   = ID_dec1Rd;
+        rd2   = ID_dec2Rd;
+        rs1_2 = ID_dec2Rs1;
+        rs2_2 = ID_dec2Rs2;
+
+        // func = {funct3, inst[30]}, is_mtype = inst[25]; the shamt
+        // of slli sits in the rs2 field
+        isLui   = (ID_dec1Op == `OP_LUI);
+        isAuipc = (ID_dec1Op == `OP_AUIPC);
+        isSlli  = (ID_dec1Op == `OP_I_ARITH) && (ID_dec1Func == 4'b0010) && ~ID_dec1IsM
+               && (ID_dec1Rs2[4:2] == 3'd0) && (ID_dec1Rs2[1:0] != 2'd0);       // shamt 1..3
+        isSlt   = (ID_dec1Op == `OP_RM_TYPE) && (ID_dec1Func[3:2] == 2'b01) && ~ID_dec1Func[0] && ~ID_dec1IsM;
+
+        isAddi  = (ID_dec2Op == `OP_I_ARITH) && (ID_dec2Func[3:1] == 3'b000) && (rd2 == rd1) && (rs1_2 == rd1);
+        isJalr  = (ID_dec2Op == `OP_JALR) && (rd2 == rd1) && (rs1_2 == rd1);
+        isAdd   = (ID_dec2Op == `OP_RM_TYPE) && (ID_dec2Func == 4'b0000) && ~ID_dec2IsM && (rd2 == rd1)
+               && ((rs1_2 == rd1) ^ (rs2_2 == rd1));
+        isBeqz  = (ID_dec2Op == `OP_B_TYPE) && (ID_dec2Func[3:2] == 2'b00)
+               && (((rs1_2 == rd1) && (rs2_2 == 5'd0)) || ((rs2_2 == rd1) && (rs1_2 == 5'd0)));
+
+        ID_fuseType = `FUSE_LUI;
+        ID_fuse     = 1'b0;
+        if (ID_valid2 && ~ID_pTaken && (rd1 != 5'd0)) begin
+            if (isLui && isAddi) begin
+                ID_fuse     = 1'b1;
+                ID_fuseType = `FUSE_LUI;
+            end else if (isAuipc && isJalr) begin
+                ID_fuse     = 1'b1;
+                ID_fuseType = `FUSE_CALL;
+            end else if (isSlli && isAdd) begin
+                ID_fuse     = 1'b1;
+                ID_fuseType = `FUSE_SHADD;
+            end else if (isSlt && isBeqz) begin
+                ID_fuse     = 1'b1;
+                ID_fuseType = `FUSE_CMPBR;
+            end
+        end
+    end
+
 endmodule
@@ -13,7 +13,7 @@ module Controller_WB (
     // -----------------------------
     // Enable integer register writeback
     // -----------------------------
-    assign WB_wbEnable = (WB_op == `OP_LUI || WB_op == `OP_AUIPC || WB_op == `OP_JAL || WB_op == `OP_JALR  || WB_op == `OP_I_LOAD || WB_op == `OP_I_ARITH || WB_op == `OP_RM_TYPE || WB_op == `OP_CSR);
+    assign WB_wbEnable = (WB_op == `OP_LUI || WB_op == `OP_AUIPC || WB_op == `OP_JAL || WB_op == `OP_JALR  || WB_op == `OP_I_LOAD || WB_op == `OP_I_ARITH || WB_op == `OP_RM_TYPE || WB_op == `OP_CSR || WB_op == `OP_CMP_BR);
 
     // -----------------------------
     // Enable floating-point register writeback
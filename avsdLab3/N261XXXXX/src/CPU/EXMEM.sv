@@ -2,8 +2,8 @@ module EXMEM (
     // input
     input  logic        clk,
     input  logic        rst,
-    input  logic        IF_DONE,
-    input  logic        MEM_DONE,
+    input  logic        ready,
+    input  logic        flush,
     input  logic [4:0]  EX_op,
     input  logic [3:0]  EX_func,
     input  logic [4:0]  EX_rd,
@@ -20,7 +20,7 @@ module EXMEM (
 
     // ============================================================
     // Pipeline register: transfer signals from E-stage to M-stage
-    // Handles reset condition by inserting a bubble
+    // Handles reset and flush (interrupted EX) by inserting a bubble
     // ============================================================
     always_ff @(posedge clk or posedge rst) begin
         if (rst) begin
@@ -32,7 +32,16 @@ module EXMEM (
             MEM_op        <= 5'd0;
             MEM_func3     <= 3'd0;
             MEM_rd        <= 5'd0;
-        end else if (IF_DONE && MEM_DONE)begin
+        end else if (ready && flush) begin
+            // -----------------------------
+            // Flush: insert bubble
+            // -----------------------------
+            MEM_aluOut    <= 32'd0;
+            MEM_rs2_data  <= 32'd0;
+            MEM_op        <= `BUBBLE_OPCODE;
+            MEM_func3     <= 3'd0;
+            MEM_rd        <= 5'd0;
+        end else if (ready) begin
             // -----------------------------
             // Normal operation: pass E-stage values to M-stage
             // -----------------------------
@@ -1,4 +1,9 @@
-module FPU (
+module FPU #(
+    parameter bit PIPE = 1'b0   // 1: register between add and round/normalize
+) (
+    input clk,
+    input rst,
+    input load,                 // PIPE: capture stage 1 (first EX cycle)
     input [31:0] src1,
     input [31:0] src2,
     input sub,
@@ -23,11 +28,18 @@ logic [24:0] significand_round;
 
 logic [4:0] shift;
 
+logic sign_res;
+
+// stage 1 -> stage 2
+logic s_sign, s_op;
+logic [7:0] s_exp;
+logic [31:0] s_res;
+
 //for operations always operand_a must not be less than b_operand
 assign {Comp_enable,operand_a,operand_b} = (src1[30:0] < src2[30:0]) ? {1'b1, src2, src1} : {1'b0, src1, src2};
 
 // sub: 1 for sub, 0 for add
-assign fpuOut[31] = sub ? Comp_enable ? !operand_a[31] : operand_a[31] : operand_a[31] ;
+assign sign_res = sub ? Comp_enable ? !operand_a[31] : operand_a[31] : operand_a[31] ;
 
 // operation 1 for add, 0 for sub
 assign operation = sub ? operand_a[31] ^ operand_b[31] : ~(operand_a[31] ^ operand_b[31]);
@@ -46,26 +58,54 @@ assign significand_b_shift = {significand_b, 7'd0} >> exponent_diff;
 
 assign significand_res = (operation) ? ({1'b0, significand_a_shift} + {1'b0, significand_b_shift}) : ({1'b0, significand_a_shift} - {1'b0, significand_b_shift});
 
+//Stage boundary: aligned sum / difference is registered when PIPE
+generate
+    if (PIPE) begin : g_pipe
+        always_ff @(posedge clk or posedge rst) begin
+            if (rst) begin
+                s_sign <= 1'b0;
+                s_op   <= 1'b0;
+                s_exp  <= 8'd0;
+                s_res  <= 32'd0;
+            end
+            else if (load) begin
+                s_sign <= sign_res;
+                s_op   <= operation;
+                s_exp  <= operand_a[30:23];
+                s_res  <= significand_res;
+            end
+        end
+    end
+    else begin : g_comb
+        assign s_sign = sign_res;
+        assign s_op   = operation;
+        assign s_exp  = operand_a[30:23];
+        assign s_res  = significand_res;
+    end
+endgenerate
+
+assign fpuOut[31] = s_sign;
+
 always_comb begin
-    if (significand_res[6]) begin
-        if(significand_res[7]) significand_round = significand_res[31:7] + 25'd1;
-        else significand_round = significand_res[31:7] + {24'd0, (|significand_res[6:0])};
+    if (s_res[6]) begin
+        if(s_res[7]) significand_round = s_res[31:7] + 25'd1;
+        else significand_round = s_res[31:7] + {24'd0, (|s_res[6:0])};
     end
-    else significand_round = significand_res[31:7];
+    else significand_round = s_res[31:7];
 end
 
 
 //Result will be equal to Most 23 bits if carry generates else it will be Least 22 bits.
 always_comb begin
-    if (operation) begin // 1 for add
+    if (s_op) begin // 1 for add
         shift = 5'd0;
         if(significand_round[24]) begin
             fpuOut[22:0] = significand_round[23:1];
-            fpuOut[30:23] = operand_a[30:23] + 8'd1;
+            fpuOut[30:23] = s_exp + 8'd1;
         end
         else begin
             fpuOut[22:0] = significand_round[22:0];
-            fpuOut[30:23] = operand_a[30:23];
+            fpuOut[30:23] = s_exp;
         end
 
     end
@@ -172,7 +212,7 @@ always_comb begin
                 fpuOut[22:0] = 23'd0;
             end
         endcase
-        fpuOut[30:23] = operand_a[30:23] - {3'd0, shift};
+        fpuOut[30:23] = s_exp - {3'd0, shift};
     end
 end
 
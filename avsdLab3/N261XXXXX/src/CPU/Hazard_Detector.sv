@@ -10,7 +10,9 @@ module Hazard_Detector (
     input logic [4:0]   EX_rd,
     input logic [4:0]   EX_rs1,
     input logic [4:0]   EX_rs2,
+    input logic         EX_mul,     // EX op is a pipelined MUL (deep pipeline)
     input logic [4:0]   MEM_op,
+    input logic         MEM_mul,    // MEM holds a pipelined MUL
     input logic [4:0]   MEM_rd,
     input logic [4:0]   WB_op,
     input logic [4:0]   WB_rd,
@@ -33,6 +35,7 @@ module Hazard_Detector (
 
     logic EX_use_ld, EX_use_fld;
     logic ID_rs1_EX_rd, ID_rs2_EX_rd;
+    logic ID_rs1_MEM_rd, ID_rs2_MEM_rd;
 
     // ============================================================
     // Forwarding Logic
@@ -41,8 +44,8 @@ module Hazard_Detector (
     // -----------------------------
     // EX Stage Register Usage
     // -----------------------------
-    assign EX_use_rs1  = (EX_op == `OP_RM_TYPE || EX_op == `OP_I_ARITH || EX_op == `OP_I_LOAD || EX_op == `OP_JALR || EX_op == `OP_S_TYPE || EX_op == `OP_B_TYPE || EX_op == `OP_FLW || EX_op == `OP_FSW || EX_op == `OP_CSR);
-    assign EX_use_rs2  = (EX_op == `OP_RM_TYPE || EX_op == `OP_B_TYPE || EX_op == `OP_S_TYPE);
+    assign EX_use_rs1  = (EX_op == `OP_RM_TYPE || EX_op == `OP_I_ARITH || EX_op == `OP_I_LOAD || EX_op == `OP_JALR || EX_op == `OP_S_TYPE || EX_op == `OP_B_TYPE || EX_op == `OP_FLW || EX_op == `OP_FSW || EX_op == `OP_CSR || EX_op == `OP_CMP_BR);
+    assign EX_use_rs2  = (EX_op == `OP_RM_TYPE || EX_op == `OP_B_TYPE || EX_op == `OP_S_TYPE || EX_op == `OP_CMP_BR);
     assign EX_use_frs1 = (EX_op == `OP_FTYPE);
     assign EX_use_frs2 = (EX_op == `OP_FTYPE || EX_op == `OP_FSW);
 
@@ -50,8 +53,8 @@ module Hazard_Detector (
     // -----------------------------
     // MEM / WB Stage Register Destination
     // -----------------------------
-    assign MEM_use_rd   = (MEM_op == `OP_RM_TYPE || MEM_op == `OP_I_LOAD || MEM_op == `OP_I_ARITH || MEM_op == `OP_AUIPC || MEM_op == `OP_LUI || MEM_op == `OP_JALR || MEM_op == `OP_JAL || MEM_op == `OP_CSR);
-    assign WB_use_rd    = (WB_op  == `OP_RM_TYPE || WB_op  == `OP_I_LOAD || WB_op  == `OP_I_ARITH || WB_op  == `OP_AUIPC || WB_op  == `OP_LUI || WB_op  == `OP_JALR || WB_op  == `OP_JAL || WB_op  == `OP_CSR);
+    assign MEM_use_rd   = (MEM_op == `OP_RM_TYPE || MEM_op == `OP_I_LOAD || MEM_op == `OP_I_ARITH || MEM_op == `OP_AUIPC || MEM_op == `OP_LUI || MEM_op == `OP_JALR || MEM_op == `OP_JAL || MEM_op == `OP_CSR || MEM_op == `OP_CMP_BR);
+    assign WB_use_rd    = (WB_op  == `OP_RM_TYPE || WB_op  == `OP_I_LOAD || WB_op  == `OP_I_ARITH || WB_op  == `OP_AUIPC || WB_op  == `OP_LUI || WB_op  == `OP_JALR || WB_op  == `OP_JAL || WB_op  == `OP_CSR || WB_op  == `OP_CMP_BR);
     assign MEM_use_frd  = (MEM_op == `OP_FTYPE || MEM_op == `OP_FLW);
     assign WB_use_frd   = (WB_op  == `OP_FTYPE || WB_op  == `OP_FLW);
 
@@ -85,12 +88,20 @@ module Hazard_Detector (
     // -----------------------------
     // ID rsx and EX rd Overlapping
     // -----------------------------
-    assign ID_rs1_EX_rd   = (  (ID_rs1 == EX_rd) && EX_rd != 5'd0  ) && ((ID_use_rs1 && EX_use_ld) || (ID_use_frs1 && EX_use_fld));
-    assign ID_rs2_EX_rd   = (  (ID_rs2 == EX_rd) && EX_rd != 5'd0  ) && ((ID_use_rs2 && EX_use_ld) || (ID_use_frs2 && EX_use_fld));
+    assign ID_rs1_EX_rd   = (  (ID_rs1 == EX_rd) && EX_rd != 5'd0  ) && ((ID_use_rs1 && (EX_use_ld || EX_mul)) || (ID_use_frs1 && EX_use_fld));
+    assign ID_rs2_EX_rd   = (  (ID_rs2 == EX_rd) && EX_rd != 5'd0  ) && ((ID_use_rs2 && (EX_use_ld || EX_mul)) || (ID_use_frs2 && EX_use_fld));
 
     // -----------------------------
-    // Load Stall Logic
+    // ID rsx and MEM rd Overlapping
+    // (a MUL result is summed in WB and
+    //  only reaches ID through WB -> ID)
+    // -----------------------------
+    assign ID_rs1_MEM_rd  = (  (ID_rs1 == MEM_rd) && MEM_rd != 5'd0  ) && ID_use_rs1 && MEM_mul;
+    assign ID_rs2_MEM_rd  = (  (ID_rs2 == MEM_rd) && MEM_rd != 5'd0  ) && ID_use_rs2 && MEM_mul;
+
+    // -----------------------------
+    // Load / MUL Stall Logic
     // -----------------------------
-    assign loadStall = ID_rs1_EX_rd || ID_rs2_EX_rd;
+    assign loadStall = ID_rs1_EX_rd || ID_rs2_EX_rd || ID_rs1_MEM_rd || ID_rs2_MEM_rd;
 
 endmodule
\ No newline at end of file
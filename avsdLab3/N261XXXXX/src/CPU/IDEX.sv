@@ -1,12 +1,12 @@
 module IDEX (
     input  logic        clk,
     input  logic        rst,
-    input  logic        IF_DONE,
-    input  logic        MEM_DONE,
+    input  logic        ready,
 
     input  logic        flush,
     input  logic        stall,
 
+    input  logic        ID_valid,
     input  logic [31:0] ID_pc,
     input  logic [4:0]  ID_op,
     input  logic [3:0]  ID_func,
@@ -20,10 +20,12 @@ module IDEX (
     input  logic [31:0] ID_rs2_data,
     input  logic [31:0] ID_Imm,
     input  logic        ID_pTaken,
+    input  logic [31:0] ID_pTarget,
     input  logic        ID_WFI,
     input  logic        ID_MRET,
+    input  logic        ID_fused,
 
-
+    output logic        EX_valid,
     output logic [31:0] EX_pc,
     output logic [4:0]  EX_op,
     output logic [3:0]  EX_func,
@@ -37,19 +39,22 @@ module IDEX (
     output logic [31:0] EX_rs2_data,
     output logic [31:0] EX_Imm,
     output logic        EX_pTaken,
+    output logic [31:0] EX_pTarget,
     output logic        EX_WFI,
-    output logic        EX_MRET
+    output logic        EX_MRET,
+    output logic        EX_fused
 );
 
     // ============================================================
     // Pipeline register: transfer signals from D-stage to E-stage
-    // Handles reset and flush conditions by inserting a bubble
+    // Handles reset, flush and empty ID by inserting a bubble
     // ============================================================
     always_ff @(posedge clk or posedge rst) begin
         if (rst) begin
             // -----------------------------
             // Reset: insert bubble
             // -----------------------------
+            EX_valid      <= 1'b0;
             EX_op         <= 5'd0;
             EX_func       <= 4'd0;
             EX_rd         <= 5'd0;
@@ -63,13 +68,16 @@ module IDEX (
             EX_rs2_data   <= 32'd0;
             EX_Imm        <= 32'd0;
             EX_pTaken     <= 1'b0;
+            EX_pTarget    <= 32'd0;
             EX_WFI        <= 1'b0;
             EX_MRET       <= 1'b0;
-        end else if (IF_DONE && MEM_DONE)begin
-            if (flush) begin
+            EX_fused      <= 1'b0;
+        end else if (ready) begin
+            if (flush || (~stall && ~ID_valid)) begin
                 // -----------------------------
-                // Flush: insert bubble
+                // Flush / empty ID: insert bubble
                 // -----------------------------
+                EX_valid      <= 1'b0;
                 EX_op         <= `BUBBLE_OPCODE;
                 EX_func       <= 4'd0;
                 EX_rd         <= 5'd0;
@@ -83,12 +91,15 @@ module IDEX (
                 EX_rs2_data   <= 32'd0;
                 EX_Imm        <= 32'd0;
                 EX_pTaken     <= 1'b0;
+                EX_pTarget    <= 32'd0;
                 EX_WFI        <= 1'b0;
                 EX_MRET       <= 1'b0;
+                EX_fused      <= 1'b0;
             end else if (~stall) begin
                 // -----------------------------
                 // Normal operation: pass D-stage values to E-stage
                 // -----------------------------
+                EX_valid      <= 1'b1;
                 EX_op         <= ID_op;
                 EX_func       <= ID_func;
                 EX_rd         <= ID_rd;
@@ -102,8 +113,10 @@ module IDEX (
                 EX_rs2_data   <= ID_rs2_data;
                 EX_Imm        <= ID_Imm;
                 EX_pTaken     <= ID_pTaken;
+                EX_pTarget    <= ID_pTarget;
                 EX_WFI        <= ID_WFI;
                 EX_MRET       <= ID_MRET;
+                EX_fused      <= ID_fused;
             end
         end
     end
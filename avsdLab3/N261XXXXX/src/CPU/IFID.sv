@@ -1,58 +1,124 @@
-module IFID (
+module IFID #(
+    parameter int DEPTH = 2
+) (
     input  logic        clk,
     input  logic        rst,
-    input  logic        IF_DONE,
-    input  logic        MEM_DONE,
-    input  logic        stall,
+    input  logic        push,
+    input  logic        pop,
+    input  logic        pop2,       // with pop: the head pair issued as one op
     input  logic        flush,
     input  logic [31:0] IF_pc,
     input  logic [31:0] IF_inst,
     input  logic        IF_pTaken,
+    input  logic [31:0] IF_pTarget,
+    output logic [$clog2(DEPTH+1)-1:0] room,   // free entries
+    output logic        ID_valid,
     output logic [31:0] ID_pc,
     output logic [31:0] ID_inst,
-    output logic        ID_pTaken
+    output logic        ID_pTaken,
+    output logic [31:0] ID_pTarget,
+
+    // entry behind the head (fusion partner)
+    output logic        ID_valid2,
+    output logic [31:0] ID_pc2,
+    output logic [31:0] ID_inst2,
+    output logic        ID_pTaken2,
+    output logic [31:0] ID_pTarget2
 );
 
     // ============================================================
-    // Locals Registers
+    // Local Parameters
     // ============================================================
-    logic [31:0]        buffer;
-    logic               valid;
+    localparam int PTR_BITS = (DEPTH > 1) ? $clog2(DEPTH) : 1;
 
     // ============================================================
-    // Reset and Update
+    // Fetch Queue
+    // ------------------------------------------------------------
+    // IF pushes whenever a fetch beat returns, ID pops whenever
+    // EX accepts, so fetch keeps running while the back end waits.
     // ============================================================
-    always_ff @(posedge clk or posedge rst) begin
-        if (rst) begin
-            ID_pc     <= 32'd0;
-            ID_pTaken <= 1'b0;
-            ID_inst   <= 32'd0;
-        end else if (IF_DONE && MEM_DONE) begin
-            if (flush) begin
-                ID_pc     <= 32'd0;
-                ID_pTaken <= 1'b0;
-                ID_inst   <= `BUBBLE_INST;
-            end else if (~stall) begin
-                ID_pc     <= IF_pc;
-                ID_pTaken <= IF_pTaken;
-                ID_inst   <= (valid) ? buffer : IF_inst;
-            end
+    logic [31:0]        q_pc     [DEPTH-1:0];
+    logic [31:0]        q_inst   [DEPTH-1:0];
+    logic               q_pTaken [DEPTH-1:0];
+    logic [31:0]        q_pTarget[DEPTH-1:0];
+    logic [PTR_BITS-1:0] head, tail, head1, head2;
+    logic [PTR_BITS:0]  count;
+    logic               full;
+    logic               do_push, do_pop, do_pop2;
+
+    assign full      = (count == DEPTH);
+    assign room      = ($clog2(DEPTH+1))'(DEPTH - count);
+    assign ID_valid  = (count != '0);
+    assign ID_valid2 = (count >= 2);
+
+    assign head1     = (head  == PTR_BITS'(DEPTH-1)) ? '0 : head  + 1'b1;
+    assign head2     = (head1 == PTR_BITS'(DEPTH-1)) ? '0 : head1 + 1'b1;
+
+    assign do_push   = push && ~full;
+    assign do_pop    = pop  && ID_valid;
+    assign do_pop2   = do_pop && pop2 && ID_valid2;
+
+    // ============================================================
+    // ID Stage Outputs (bubble when empty)
+    // ============================================================
+    always_comb begin
+        if (ID_valid) begin
+            ID_pc      = q_pc[head];
+            ID_inst    = q_inst[head];
+            ID_pTaken  = q_pTaken[head];
+            ID_pTarget = q_pTarget[head];
+        end else begin
+            ID_pc      = 32'd0;
+            ID_inst    = `BUBBLE_INST;
+            ID_pTaken  = 1'b0;
+            ID_pTarget = 32'd0;
+        end
+
+        if (ID_valid2) begin
+            ID_pc2      = q_pc[head1];
+            ID_inst2    = q_inst[head1];
+            ID_pTaken2  = q_pTaken[head1];
+            ID_pTarget2 = q_pTarget[head1];
+        end else begin
+            ID_pc2      = 32'd0;
+            ID_inst2    = `BUBBLE_INST;
+            ID_pTaken2  = 1'b0;
+            ID_pTarget2 = 32'd0;
         end
     end
 
     // ============================================================
-    // Buffer for IF_RdData
+    // Reset and Update
     // ============================================================
     always_ff @(posedge clk or posedge rst) begin
         if (rst) begin
-            valid  <= 1'b0;
-            buffer <= 32'd0;
-        end else if (IF_DONE && ~MEM_DONE && valid == 1'b0) begin
-            buffer <= IF_inst;
-            valid  <= 1'b1;
-        end else if (IF_DONE && MEM_DONE) begin
-            valid  <= 1'b0;
-            buffer <= 32'd0;
+            for (int i = 0; i < DEPTH; i++) begin
+                q_pc[i]      <= 32'd0;
+                q_inst[i]    <= 32'd0;
+                q_pTaken[i]  <= 1'b0;
+                q_pTarget[i] <= 32'd0;
+            end
+            head  <= '0;
+            tail  <= '0;
+            count <= '0;
+        end else if (flush) begin
+            head  <= '0;
+            tail  <= '0;
+            count <= '0;
+        end else begin
+            if (do_push) begin
+                q_pc[tail]      <= IF_pc;
+                q_inst[tail]    <= IF_inst;
+                q_pTaken[tail]  <= IF_pTaken;
+                q_pTarget[tail] <= IF_pTarget;
+                tail            <= (tail == PTR_BITS'(DEPTH-1)) ? '0 : tail + 1'b1;
+            end
+            if (do_pop) begin
+                head            <= do_pop2 ? head2 : head1;
+            end
+            count <= count + (PTR_BITS+1)'(do_push)
+                           - (PTR_BITS+1)'(do_pop)
+                           - (PTR_BITS+1)'(do_pop2);
         end
     end
 
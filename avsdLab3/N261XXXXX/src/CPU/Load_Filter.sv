@@ -1,34 +1,37 @@
 module Load_Filter (
     input  logic [ 1:0] byteOffset,
     input  logic [31:0] memData,
+    input  logic [31:0] memDataHi,      // next word (split load only)
     input  logic [ 2:0] func3,
     output logic [31:0] loadData
 );
 
-    logic [31:0] dataShiftByte;
-    logic [31:0] dataShiftHalf;
+    logic [63:0] dataShift;
 
     // ============================================================
     // Load Data Filter
+    // ------------------------------------------------------------
+    // The addressed word and the one after it form a two-word
+    // window, so a half/word that crosses the boundary is taken
+    // from both. memDataHi is only meaningful for split loads.
     // ============================================================
     always_comb begin
-        dataShiftByte = memData >> (byteOffset * 8);
-        dataShiftHalf = memData >> (byteOffset[1] * 16);
+        dataShift = {memDataHi, memData} >> (byteOffset * 8);
 
         case (func3)
 
             // ----------------------------------------------------
             // Signed Byte / Half / Word
             // ----------------------------------------------------
-            `MEM_BYTE:   loadData = {{24{dataShiftByte[7]}},  dataShiftByte[7:0]};
-            `MEM_HALF:   loadData = {{16{dataShiftHalf[15]}}, dataShiftHalf[15:0]};
-            `MEM_WORD:   loadData = memData;
+            `MEM_BYTE:   loadData = {{24{dataShift[7]}},  dataShift[7:0]};
+            `MEM_HALF:   loadData = {{16{dataShift[15]}}, dataShift[15:0]};
+            `MEM_WORD:   loadData = dataShift[31:0];
 
             // ----------------------------------------------------
             // Unsigned Byte / Half
             // ----------------------------------------------------
-            `MEM_UBYTE:  loadData = {24'd0, dataShiftByte[7:0]};
-            `MEM_UHALF:  loadData = {16'd0, dataShiftHalf[15:0]};
+            `MEM_UBYTE:  loadData = {24'd0, dataShift[7:0]};
+            `MEM_UHALF:  loadData = {16'd0, dataShift[15:0]};
 
             // ----------------------------------------------------
             // Default
@@ -2,27 +2,22 @@ module MEMWB (
     // input
     input  logic        clk,
     input  logic        rst,
-    input  logic        IF_DONE,
-    input  logic        MEM_DONE,
+    input  logic        ready,
     input  logic [4:0]  MEM_op,
     input  logic [4:0]  MEM_rd,
     input  logic [2:0]  MEM_func3,
     input  logic [31:0] MEM_aluOut,
     input  logic [31:0] MEM_ReadData,
+    input  logic [31:0] MEM_ReadDataHi,
     // output
     output logic [4:0]  WB_op,
     output logic [4:0]  WB_rd,
     output logic [2:0]  WB_func3,
     output logic [31:0] WB_aluOut,
-    output logic [31:0] WB_ReadData
+    output logic [31:0] WB_ReadData,
+    output logic [31:0] WB_ReadDataHi
 );
 
-    // ============================================================
-    // Locals Registers
-    // ============================================================
-    logic [31:0]        buffer;
-    logic               valid;
-
     // ============================================================
     // Pipeline register
     // ============================================================
@@ -36,7 +31,8 @@ module MEMWB (
             WB_func3     <= 3'd0;
             WB_rd        <= 5'd0;
             WB_ReadData  <= 32'd0;
-        end else if (IF_DONE && MEM_DONE) begin
+            WB_ReadDataHi <= 32'd0;
+        end else if (ready) begin
             // -----------------------------
             // Updata
             // -----------------------------
@@ -44,23 +40,8 @@ module MEMWB (
             WB_op        <= MEM_op;
             WB_func3     <= MEM_func3;
             WB_rd        <= MEM_rd;
-            WB_ReadData  <= (valid) ? buffer : MEM_ReadData;
-        end
-    end
-
-    // ============================================================
-    // Buffer for MEMEM_RdData
-    // ============================================================
-    always_ff @(posedge clk or posedge rst) begin
-        if (rst) begin
-            valid  <= 1'b0;
-            buffer <= 32'd0;
-        end else if (~IF_DONE && MEM_DONE && valid == 1'b0) begin
-            buffer <= MEM_ReadData;
-            valid  <= 1'b1;
-        end else if (IF_DONE && MEM_DONE) begin
-            valid  <= 1'b0;
-            buffer <= 32'd0;
+            WB_ReadData  <= MEM_ReadData;
+            WB_ReadDataHi <= MEM_ReadDataHi;
         end
     end
 
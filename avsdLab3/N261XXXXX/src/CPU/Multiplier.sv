@@ -0,0 +1,127 @@
+// ============================================================
+// Pipelined Multiplier (deep pipeline)
+// ------------------------------------------------------------
+// The three stages ride alongside EX, MEM and WB and move with
+// the EX-MEM / MEM-WB registers, so a MUL issues every cycle:
+//   EX   operand magnitude (after the EX forwarding muxes)
+//   MEM  four 16x16 partial products
+//   WB   sum, sign restore, half select
+// ============================================================
+module Multiplier (
+    input  logic        clk,
+    input  logic        rst,
+    input  logic        advance,    // EX-MEM / MEM-WB registers move
+    input  logic        valid,      // a MUL leaves EX this cycle
+
+    input  logic [31:0] src1,
+    input  logic [31:0] src2,
+    input  logic [3:0]  func,
+
+    output logic        memValid,   // a MUL is in MEM (partial products)
+    output logic        wbValid,    // a MUL is in WB, mulOut is its result
+    output logic [31:0] mulOut
+);
+
+    // ============================================================
+    // Local Signals
+    // ============================================================
+    logic [31:0] abs_src1, abs_src2;
+    logic        sign;
+
+    // Stage 1 -> Stage 2 registers
+    logic [31:0] abs_a_r, abs_b_r;
+    logic        sign_r;
+    logic        high_r;
+
+    // Stage 2 -> Stage 3 registers
+    logic [31:0] pp_ll, pp_lh, pp_hl, pp_hh;
+    logic        sign_w;
+    logic        high_w;
+
+    logic [63:0] abs_mul_res, mul_res;
+
+    // ============================================================
+    // Stage 1: operand magnitude
+    // ============================================================
+    always_comb begin
+        sign = 1'b0;
+        case (func[3:1])
+            `FUNC_MULH: begin // signed × signed
+                abs_src1 = (src1 ^ {32{src1[31]}}) + {31'd0, src1[31]};
+                abs_src2 = (src2 ^ {32{src2[31]}}) + {31'd0, src2[31]};
+                sign = src1[31] ^ src2[31];
+            end
+            `FUNC_MULHSU: begin // signed × unsigned
+                abs_src1 = (src1 ^ {32{src1[31]}}) + {31'd0, src1[31]};
+                abs_src2 = src2;
+                sign = src1[31];
+            end
+            `FUNC_MUL, `FUNC_MULHU: begin // unsigned × unsigned
+                abs_src1 = src1;
+                abs_src2 = src2;
+            end
+            default: begin
+                abs_src1 = 32'd0;
+                abs_src2 = 32'd0;
+            end
+        endcase
+    end
+
+    always_ff @(posedge clk or posedge rst) begin
+        if (rst) begin
+            abs_a_r <= 32'd0;
+            abs_b_r <= 32'd0;
+            sign_r  <= 1'b0;
+            high_r  <= 1'b0;
+        end else if (advance && valid) begin
+            abs_a_r <= abs_src1;
+            abs_b_r <= abs_src2;
+            sign_r  <= sign;
+            high_r  <= (func[3:1] != `FUNC_MUL);
+        end
+    end
+
+    // ============================================================
+    // Stage 2: four 16x16 partial products
+    // ============================================================
+    always_ff @(posedge clk or posedge rst) begin
+        if (rst) begin
+            pp_ll   <= 32'd0;
+            pp_lh   <= 32'd0;
+            pp_hl   <= 32'd0;
+            pp_hh   <= 32'd0;
+            sign_w  <= 1'b0;
+            high_w  <= 1'b0;
+        end else if (advance && memValid) begin
+            pp_ll   <= abs_a_r[15:0]  * abs_b_r[15:0];
+            pp_lh   <= abs_a_r[15:0]  * abs_b_r[31:16];
+            pp_hl   <= abs_a_r[31:16] * abs_b_r[15:0];
+            pp_hh   <= abs_a_r[31:16] * abs_b_r[31:16];
+            sign_w  <= sign_r;
+            high_w  <= high_r;
+        end
+    end
+
+    // ============================================================
+    // Stage Valids (bubbles where EX-MEM / MEM-WB carry a non-MUL)
+    // ============================================================
+    always_ff @(posedge clk or posedge rst) begin
+        if (rst) begin
+            memValid <= 1'b0;
+            wbValid  <= 1'b0;
+        end else if (advance) begin
+            memValid <= valid;
+            wbValid  <= memValid;
+        end
+    end
+
+    // ============================================================
+    // Stage 3: sum partial products, restore sign, select half
+    // ============================================================
+    always_comb begin
+        abs_mul_res = {pp_hh, pp_ll} + {16'd0, pp_lh, 16'd0} + {16'd0, pp_hl, 16'd0};
+        mul_res     = (abs_mul_res ^ {64{sign_w}}) + {63'd0, sign_w};
+        mulOut      = high_w ? mul_res[63:32] : mul_res[31:0];
+    end
+
+endmodule
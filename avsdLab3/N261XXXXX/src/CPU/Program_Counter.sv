@@ -1,30 +1,66 @@
 module Program_Counter (
     input  logic        clk,
     input  logic        rst,
-    input  logic        IF_DONE,
-    input  logic        MEM_DONE,
+    input  logic        IF_DONE,    // fetch request finished (last beat, or no request)
+    input  logic        IF_BEAT,    // an instruction beat returned
 
-    input  logic        stall,
-    input  logic        flush,
+    input  logic        redirect,
     input  logic        pTaken,
 
     input  logic [31:0] pTarget,
     input  logic [31:0] fTarget,
-    output logic [31:0] pc
+    output logic [31:0] pc,
+    output logic [31:0] nextPc,
+    output logic        drop
 );
 
+    // ============================================================
+    // Local Registers
+    // ============================================================
+    logic               pending;
+    logic [31:0]        pendingTarget;
+
+    // ============================================================
+    // Next PC
+    // ------------------------------------------------------------
+    // A fetch is a burst to the end of the aligned 4-word block;
+    // the PC steps with each beat. A redirect, or a taken
+    // prediction on a beat before the last, is held until the
+    // burst completes and the remaining beats are dropped.
+    // ============================================================
+    always_comb begin
+        nextPc = pc;
+        if (IF_DONE) begin
+            if      (redirect) nextPc = fTarget;
+            else if (pending)  nextPc = pendingTarget;
+            else if (IF_BEAT)  nextPc = pTaken ? pTarget : pc + 32'd4;
+        end else if (IF_BEAT && ~redirect && ~pending && ~pTaken) begin
+            nextPc = pc + 32'd4;
+        end
+    end
+
     // ============================================================
     // PC Register update
     // ============================================================
     always_ff @(posedge clk or posedge rst) begin
-    if (rst)             pc <= 32'd0;
-    else if (IF_DONE && MEM_DONE) begin
-        if      (flush)  pc <= fTarget;
-        else if (stall)  pc <= pc;
-        else if (pTaken) pc <= {pTarget};
-        else             pc <= pc + 32'd4;
+        if (rst) begin
+            pc            <= 32'd0;
+            pending       <= 1'b0;
+            pendingTarget <= 32'd0;
+        end else begin
+            pc <= nextPc;
+            if (IF_DONE) begin
+                pending       <= 1'b0;
+            end else if (redirect) begin
+                pending       <= 1'b1;
+                pendingTarget <= fTarget;
+            end else if (IF_BEAT && ~pending && pTaken) begin
+                pending       <= 1'b1;
+                pendingTarget <= pTarget;
+            end
+        end
     end
-end
 
+    assign drop = redirect || pending;
 
 endmodule
@@ -0,0 +1,219 @@
+module Store_Buffer #(
+    parameter int SB_ENTRIES = 4,   // number of line entries (power of 2)
+    parameter int LINE_WORDS = 4,   // words per entry / max burst length
+    parameter int DRAIN_AGE  = 16   // cycles a lone entry may wait for merges
+) (
+    input  logic        clk,
+    input  logic        rst,
+
+    // Push (retired store from MEM stage)
+    input  logic        push,
+    input  logic [31:0] push_addr,
+    input  logic [31:0] push_data,
+    input  logic [ 3:0] push_strb,
+    output logic        push_ready,
+
+    // Load lookup
+    input  logic [31:0] ld_addr,
+    output logic        ld_overlap,
+    output logic        ld_hit,
+    output logic [31:0] ld_data,
+
+    // Drain (head entry as one INCR burst)
+    input  logic        drain_force,
+    output logic        drain_req,
+    output logic [31:0] drain_addr,
+    output logic [ 3:0] drain_len,
+    input  logic [ 3:0] drain_beat,
+    output logic [31:0] drain_wdata,
+    output logic [ 3:0] drain_wstrb,
+    input  logic        drain_done,
+
+    output logic        empty
+);
+
+    // ============================================================
+    // Local Parameters
+    // ============================================================
+    localparam int IDX_BITS  = (SB_ENTRIES > 1) ? $clog2(SB_ENTRIES) : 1;
+    localparam int WORD_BITS = (LINE_WORDS > 1) ? $clog2(LINE_WORDS) : 1;
+    localparam int LINE_LSB  = WORD_BITS + 2;
+    localparam int TAG_BITS  = 32 - LINE_LSB;
+    localparam int AGE_BITS  = $clog2(DRAIN_AGE + 1);
+
+    // ============================================================
+    // Entry Storage
+    // ============================================================
+    logic                             valid [SB_ENTRIES-1:0];
+    logic [TAG_BITS-1:0]              tag   [SB_ENTRIES-1:0];
+    logic [LINE_WORDS-1:0][31:0]      data  [SB_ENTRIES-1:0];
+    logic [LINE_WORDS-1:0][ 3:0]      strb  [SB_ENTRIES-1:0];
+
+    logic [IDX_BITS-1:0]              head, tail;
+    logic [IDX_BITS:0]                count;
+    logic                             head_lock;
+    logic [AGE_BITS-1:0]              age;
+
+    // ============================================================
+    // Local Signals
+    // ============================================================
+    logic [TAG_BITS-1:0]              push_tag, ld_tag;
+    logic [WORD_BITS-1:0]             push_word, ld_word;
+    logic                             merge;
+    logic [IDX_BITS-1:0]              merge_idx, merge_age_idx;
+    logic                             full;
+
+    logic [3:0]                       ld_have;
+    logic [IDX_BITS-1:0]              age_idx;
+
+    logic [WORD_BITS-1:0]             first_word, last_word;
+    logic                             head_full, drain_cond;
+
+    assign push_tag  = push_addr[31:LINE_LSB];
+    assign push_word = push_addr[LINE_LSB-1:2];
+    assign ld_tag    = ld_addr[31:LINE_LSB];
+    assign ld_word   = ld_addr[LINE_LSB-1:2];
+
+    assign full      = (count == SB_ENTRIES);
+    assign empty     = (count == '0);
+
+    // ============================================================
+    // Merge Lookup
+    // ------------------------------------------------------------
+    // A store joins the youngest buffered entry of the same line
+    // except a head that is already committed to draining. Only
+    // that head and one open entry can share a line (a new entry
+    // is allocated only when no open one matches), but the scan
+    // runs oldest to youngest so the pick does not rely on it.
+    // ============================================================
+    always_comb begin
+        merge         = 1'b0;
+        merge_idx     = '0;
+        merge_age_idx = '0;
+        for (int k = 0; k < SB_ENTRIES; k++) begin
+            merge_age_idx = head + IDX_BITS'(k);
+            if (valid[merge_age_idx] && (tag[merge_age_idx] == push_tag) && !((merge_age_idx == head) && drain_req)) begin
+                merge     = 1'b1;
+                merge_idx = merge_age_idx;
+            end
+        end
+    end
+
+    assign push_ready = merge || ~full;
+
+    // ============================================================
+    // Load Forwarding (youngest byte wins)
+    // ============================================================
+    always_comb begin
+        ld_have = 4'd0;
+        ld_data = 32'd0;
+        for (int k = 0; k < SB_ENTRIES; k++) begin
+            age_idx = head + IDX_BITS'(k);
+            if (valid[age_idx] && (tag[age_idx] == ld_tag)) begin
+                for (int b = 0; b < 4; b++) begin
+                    if (strb[age_idx][ld_word][b]) begin
+                        ld_have[b]         = 1'b1;
+                        ld_data[b*8 +: 8]  = data[age_idx][ld_word][b*8 +: 8];
+                    end
+                end
+            end
+        end
+    end
+
+    assign ld_overlap = |ld_have;
+    assign ld_hit     = &ld_have;
+
+    // ============================================================
+    // Drain Request
+    // ------------------------------------------------------------
+    // The head drains once a younger entry exists, its line is
+    // complete, it has waited DRAIN_AGE cycles, or on demand
+    // (fence, blocked load, device store). Once raised the request
+    // holds until the burst completes.
+    // ============================================================
+    always_comb begin
+        first_word = '0;
+        last_word  = '0;
+        for (int w = LINE_WORDS-1; w >= 0; w--)
+            if (strb[head][w] != 4'd0) first_word = WORD_BITS'(w);
+        for (int w = 0; w < LINE_WORDS; w++)
+            if (strb[head][w] != 4'd0) last_word  = WORD_BITS'(w);
+
+        head_full = 1'b1;
+        for (int w = 0; w < LINE_WORDS; w++)
+            if (strb[head][w] != 4'hf) head_full = 1'b0;
+    end
+
+    assign drain_cond  = ~empty && ((count > 1) || head_full || (age == AGE_BITS'(DRAIN_AGE)) || drain_force);
+    assign drain_req   = head_lock || drain_cond;
+
+    assign drain_addr  = {tag[head], first_word, 2'b00};
+    assign drain_len   = 4'(last_word - first_word);
+    assign drain_wdata = data[head][first_word + WORD_BITS'(drain_beat)];
+    assign drain_wstrb = strb[head][first_word + WORD_BITS'(drain_beat)];
+
+    // ============================================================
+    // Reset and Update
+    // ============================================================
+    always_ff @(posedge clk or posedge rst) begin
+        if (rst) begin
+            for (int i = 0; i < SB_ENTRIES; i++) begin
+                valid[i] <= 1'b0;
+                tag[i]   <= '0;
+                data[i]  <= '0;
+                strb[i]  <= '0;
+            end
+            head      <= '0;
+            tail      <= '0;
+            count     <= '0;
+            head_lock <= 1'b0;
+            age       <= '0;
+        end else begin
+            // ---------------------------------------
+            // Push: merge or allocate at tail
+            // ---------------------------------------
+            if (push && push_ready) begin
+                if (merge) begin
+                    for (int b = 0; b < 4; b++)
+                        if (push_strb[b]) data[merge_idx][push_word][b*8 +: 8] <= push_data[b*8 +: 8];
+                    strb[merge_idx][push_word] <= strb[merge_idx][push_word] | push_strb;
+                end else begin
+                    valid[tail]            <= 1'b1;
+                    tag[tail]              <= push_tag;
+                    data[tail]             <= '0;
+                    strb[tail]             <= '0;
+                    data[tail][push_word]  <= push_data;
+                    strb[tail][push_word]  <= push_strb;
+                    tail                   <= tail + IDX_BITS'(1);
+                end
+            end
+
+            // ---------------------------------------
+            // Drain: pop head after write response
+            // ---------------------------------------
+            if (drain_done) begin
+                valid[head] <= 1'b0;
+                head        <= head + IDX_BITS'(1);
+                head_lock   <= 1'b0;
+            end else if (drain_cond) begin
+                head_lock   <= 1'b1;
+            end
+
+            // ---------------------------------------
+            // Occupancy
+            // ---------------------------------------
+            case ({push && push_ready && ~merge, drain_done})
+                2'b10:   count <= count + 1'b1;
+                2'b01:   count <= count - 1'b1;
+                default: count <= count;
+            endcase
+
+            // ---------------------------------------
+            // Head Age
+            // ---------------------------------------
+            if (drain_done || empty || drain_req) age <= '0;
+            else if (age != AGE_BITS'(DRAIN_AGE)) age <= age + 1'b1;
+        end
+    end
+
+endmodule
@@ -3,61 +3,53 @@ module Store_Filter (
     input  logic [4:0]  opcode,
     input  logic [2:0]  func3,
     input  logic [31:0] storeData,
+    input  logic        upper,          // second beat of a split store
     output logic [31:0] memData,
     output logic [3:0]  memWriteMask
 );
 
+    logic [3:0]  sizeMask;
+    logic [63:0] data64;
+    logic [7:0]  mask64;
+
     // ============================================================
     // Store Data Filter
+    // ------------------------------------------------------------
+    // Data and byte mask are placed in a two-word window at the
+    // byte offset. An aligned store only uses the lower word; a
+    // store that spills into the next word is issued twice, lower
+    // word first, then upper word at the next word address.
     // ============================================================
     always_comb begin
         // ----------------------------------------------------
         // Default: zero outputs to avoid latch
         // ----------------------------------------------------
-        memData      = `AXI_DATA_BITS'd0;
-        memWriteMask = `AXI_STRB_BITS'd0;
+        sizeMask = `AXI_STRB_BITS'd0;
 
         // ----------------------------------------------------
         // S-type Store
         // ----------------------------------------------------
         if (opcode == `OP_S_TYPE) begin
-            // Word
-            if (func3 == `MEM_WORD) begin
-                memWriteMask = `AXI_STRB_WORD;
-                memData      = storeData;
-            end
-
-            // Half-word
-            else if (func3 == `MEM_HALF) begin
-                case (byteOffset)
-                    2'b00: begin memWriteMask = `AXI_STRB_HWORD;      memData = {16'd0, storeData[15:0]};      end
-                    2'b01: begin memWriteMask = `AXI_STRB_HWORD << 1; memData = {8'd0, storeData[15:0], 8'd0}; end
-                    2'b10: begin memWriteMask = `AXI_STRB_HWORD << 2; memData = {storeData[15:0], 16'd0};      end
-                    default: begin
-                        memWriteMask = `AXI_STRB_BITS'd0;
-                        memData      = `AXI_DATA_BITS'd0;
-                    end
-                endcase
-            end
-
-            // Byte
-            else if (func3 == `MEM_BYTE) begin
-                case (byteOffset)
-                    2'b00: begin memWriteMask = `AXI_STRB_BYTE;      memData = {24'd0, storeData[7:0]};       end
-                    2'b01: begin memWriteMask = `AXI_STRB_BYTE << 1; memData = {16'd0, storeData[7:0], 8'd0}; end
-                    2'b10: begin memWriteMask = `AXI_STRB_BYTE << 2; memData = {8'd0, storeData[7:0], 16'd0}; end
-                    2'b11: begin memWriteMask = `AXI_STRB_BYTE << 3; memData = {storeData[7:0], 24'd0};       end
-                endcase
-            end
+            case (func3)
+                `MEM_WORD: sizeMask = `AXI_STRB_WORD;
+                `MEM_HALF: sizeMask = `AXI_STRB_HWORD;
+                `MEM_BYTE: sizeMask = `AXI_STRB_BYTE;
+                default:   sizeMask = `AXI_STRB_BITS'd0;
+            endcase
         end
 
         // ----------------------------------------------------
         // FSW (Floating store)
         // ----------------------------------------------------
         else if (opcode == `OP_FSW) begin
-            memWriteMask = `AXI_STRB_WORD;
-            memData      = storeData;
+            sizeMask = `AXI_STRB_WORD;
         end
+
+        data64       = {32'd0, storeData} << (byteOffset * 8);
+        mask64       = {4'd0, sizeMask}   << byteOffset;
+
+        memData      = upper ? data64[63:32] : data64[31:0];
+        memWriteMask = upper ? mask64[7:4]   : mask64[3:0];
     end
 
 endmodule
@@ -1,7 +1,10 @@
 `include "../include/AXI_define.svh"
 `include "../src/CPU/CPU.sv"
+`include "../src/CPU/Store_Buffer.sv"
 
-module CPU_wrapper (
+module CPU_wrapper #(
+    parameter int HART_ID = 0
+) (
     input  logic                      clk,
     input  logic                      rst,
 
@@ -76,6 +79,12 @@ module CPU_wrapper (
     output logic                      BREADY_M1
 );
 
+`ifdef CPU_DEEP
+    localparam bit DEEP = 1'b1;
+`else
+    localparam bit DEEP = 1'b0;
+`endif
+
 //-----------------------------------------------------------Master 0-----------------------------------------------------------//
 
     //====================================================
@@ -94,8 +103,9 @@ module CPU_wrapper (
     // Local Signals and Registers
     //====================================================
     logic [`AXI_ADDR_BITS-1:0] IF_ADDR;
+    logic [`AXI_LEN_BITS-1:0]  IF_LEN;
     logic [`AXI_DATA_BITS-1:0] IF_RdData;
-    logic                      IF_VALID, IF_DONE;
+    logic                      IF_VALID, IF_BEAT, IF_DONE;
 
     // =============================================================================
     // Finite State Machine
@@ -141,6 +151,7 @@ module CPU_wrapper (
             ReadAddress_M0: begin
                 ARVALID_M0 = IF_VALID;
                 ARADDR_M0  = IF_ADDR;
+                ARLEN_M0   = IF_LEN;
             end
             ReadData_M0: begin
                 RREADY_M0  = 1'b1;
@@ -152,9 +163,13 @@ module CPU_wrapper (
 
     // =============================================================================
     // CPU Interface
+    // -----------------------------------------------------------------------------
+    // A fetch is a burst: every R beat hands one instruction to the
+    // CPU (IF_BEAT), the last one also completes the request.
     // =============================================================================
     always_comb begin
         IF_RdData = `AXI_DATA_BITS'd0;
+        IF_BEAT   = 1'b0;
         IF_DONE   = 1'b0;
         case (CurrentState_M0)
             ReadAddress_M0: begin
@@ -162,6 +177,7 @@ module CPU_wrapper (
             end
             ReadData_M0: begin
                 IF_RdData = (RVALID_M0 && RREADY_M0) ? RDATA_M0 : `AXI_DATA_BITS'd0;
+                IF_BEAT   = (RREADY_M0 && RVALID_M0);
                 IF_DONE   = (RREADY_M0 && RLAST_M0 && RVALID_M0);
             end
             default: begin
@@ -187,11 +203,56 @@ module CPU_wrapper (
     //====================================================
     // Local Signals and Registers
     //====================================================
-    logic                      MEM_VALID, MEM_WEB, MEM_DONE;
+    logic                      MEM_VALID, MEM_WEB, MEM_FENCE, MEM_DONE;
     logic [`AXI_ADDR_BITS-1:0] MEM_ADDR;
     logic [`AXI_DATA_BITS-1:0] MEM_WrData, MEM_RdData;
     logic [`AXI_STRB_BITS-1:0] MEM_STRB;
 
+    logic                      mem_load, mem_store, mem_fence, mem_device;
+    logic                      load_go, direct_go, drain_go;
+    logic                      aw_hold;         // drain AW issued but not yet accepted
+    logic                      WriteDrain_M1;   // current write burst comes from store buffer
+    logic [`AXI_LEN_BITS-1:0]  WBeat_M1;
+
+    // MEM1 address registers (deep pipeline)
+    logic                      arv_q, awv_q, awdrain_q;
+    logic [`AXI_ADDR_BITS-1:0] araddr_q, awaddr_q;
+    logic [`AXI_LEN_BITS-1:0]  awlen_q;
+
+    logic                      sb_push, sb_push_ready;
+    logic                      sb_ld_overlap, sb_ld_hit;
+    logic [`AXI_DATA_BITS-1:0] sb_ld_data;
+    logic                      sb_drain_force, sb_drain_req, sb_drain_done;
+    logic [`AXI_ADDR_BITS-1:0] sb_drain_addr;
+    logic [`AXI_LEN_BITS-1:0]  sb_drain_len;
+    logic [`AXI_DATA_BITS-1:0] sb_drain_wdata;
+    logic [`AXI_STRB_BITS-1:0] sb_drain_wstrb;
+    logic                      sb_empty;
+
+    // =============================================================================
+    // Request Classification
+    // -----------------------------------------------------------------------------
+    // Stores to memory (ROM/IM/DM/DRAM) retire into the store buffer. Stores to the
+    // peripheral region (0x1xxx_xxxx) stay non-posted and wait for an empty buffer
+    // so device side effects keep program order. Loads that do not touch buffered
+    // bytes bypass the buffer; fully covered loads are forwarded from it.
+    // =============================================================================
+    always_comb begin
+        mem_load   = MEM_VALID && ~MEM_WEB && ~MEM_FENCE;
+        mem_store  = MEM_VALID &&  MEM_WEB;
+        mem_fence  = MEM_VALID &&  MEM_FENCE;
+        mem_device = (MEM_ADDR[31:28] == 4'h1);
+
+        load_go    = mem_load  && ~aw_hold && (mem_device ? sb_empty : ~sb_ld_overlap);
+        direct_go  = mem_store &&  mem_device && sb_empty;
+        drain_go   = sb_drain_req && (aw_hold || ~load_go);
+
+        sb_drain_force = mem_fence
+                      || (mem_store &&  mem_device)
+                      || (mem_load  &&  mem_device)
+                      || (mem_load  && ~mem_device && sb_ld_overlap && ~sb_ld_hit);
+    end
+
     // =============================================================================
     // Finite State Machine
     // =============================================================================
@@ -230,6 +291,53 @@ module CPU_wrapper (
         endcase
     end
 
+    // ---------------------------------------
+    // Write Burst Tracking
+    // ---------------------------------------
+    always_ff @(posedge clk or posedge rst) begin
+        if (rst) begin
+            aw_hold       <= 1'b0;
+            WriteDrain_M1 <= 1'b0;
+            WBeat_M1      <= `AXI_LEN_BITS'd0;
+        end else begin
+            aw_hold       <= AWVALID_M1 && ~AWREADY_M1 && drain_go;
+            if (AWVALID_M1 && AWREADY_M1)
+                WriteDrain_M1 <= DEEP ? awdrain_q : drain_go;
+            if (AWVALID_M1 && AWREADY_M1)
+                WBeat_M1      <= `AXI_LEN_BITS'd0;
+            else if (WVALID_M1 && WREADY_M1)
+                WBeat_M1      <= WBeat_M1 + `AXI_LEN_BITS'd1;
+        end
+    end
+
+    // ---------------------------------------
+    // MEM1 Address Register (deep pipeline)
+    // ---------------------------------------
+    // AR/AW are decided one cycle and driven from flops the next, so the
+    // store-buffer compare and address mux stay off the interconnect path.
+    // A registered request is held until its handshake.
+    always_ff @(posedge clk or posedge rst) begin
+        if (rst) begin
+            arv_q     <= 1'b0;
+            awv_q     <= 1'b0;
+            awdrain_q <= 1'b0;
+            araddr_q  <= `AXI_ADDR_BITS'd0;
+            awaddr_q  <= `AXI_ADDR_BITS'd0;
+            awlen_q   <= `AXI_LEN_BITS'd0;
+        end else if (DEEP) begin
+            if (ARVALID_M1 && ARREADY_M1) arv_q <= 1'b0;
+            if (AWVALID_M1 && AWREADY_M1) awv_q <= 1'b0;
+            if ((CurrentState_M1 == AddressPhase_M1) && ~arv_q && ~awv_q) begin
+                arv_q     <= load_go;
+                araddr_q  <= MEM_ADDR;
+                awv_q     <= drain_go || direct_go;
+                awdrain_q <= drain_go;
+                awaddr_q  <= drain_go ? sb_drain_addr : MEM_ADDR;
+                awlen_q   <= drain_go ? sb_drain_len  : `AXI_LEN_ONE;
+            end
+        end
+    end
+
     // =============================================================================
     // Channel Output Logic (combinational)
     // =============================================================================
@@ -255,19 +363,34 @@ module CPU_wrapper (
 
         case (CurrentState_M1)
             AddressPhase_M1: begin
-                ARVALID_M1 = (MEM_VALID && ~MEM_WEB);
-                AWVALID_M1 = (MEM_VALID && MEM_WEB);
-                ARADDR_M1  = MEM_ADDR;
-                AWADDR_M1  = MEM_ADDR;
+                if (DEEP) begin
+                    ARVALID_M1 = arv_q;
+                    ARADDR_M1  = araddr_q;
+                    AWVALID_M1 = awv_q;
+                    AWADDR_M1  = awaddr_q;
+                    AWLEN_M1   = awlen_q;
+                end else begin
+                    ARVALID_M1 = load_go;
+                    ARADDR_M1  = MEM_ADDR;
+                    AWVALID_M1 = drain_go || direct_go;
+                    AWADDR_M1  = drain_go ? sb_drain_addr : MEM_ADDR;
+                    AWLEN_M1   = drain_go ? sb_drain_len  : `AXI_LEN_ONE;
+                end
             end
             ReadData_M1: begin
                 RREADY_M1    = 1'b1;
             end
             WriteData_M1: begin
-                WLAST_M1  = 1'b1;
                 WVALID_M1 = 1'b1;
-                WSTRB_M1  = MEM_STRB;
-                WDATA_M1  = MEM_WrData;
+                if (WriteDrain_M1) begin
+                    WLAST_M1  = (WBeat_M1 == sb_drain_len);
+                    WSTRB_M1  = sb_drain_wstrb;
+                    WDATA_M1  = sb_drain_wdata;
+                end else begin
+                    WLAST_M1  = 1'b1;
+                    WSTRB_M1  = MEM_STRB;
+                    WDATA_M1  = MEM_WrData;
+                end
             end
             WriteResponse_M1: begin
                 BREADY_M1 = 1'b1;
@@ -279,45 +402,101 @@ module CPU_wrapper (
 
     // =============================================================================
     // CPU Interface
+    // -----------------------------------------------------------------------------
+    // Buffered stores and forwarded loads complete in any state; only bypassing
+    // loads and device stores wait for their own AXI transaction.
     // =============================================================================
     always_comb begin
-        MEM_RdData = `AXI_DATA_BITS'd0;
-        MEM_DONE   = 1'b0;
-        case (CurrentState_M1)
-            AddressPhase_M1: begin
-                MEM_DONE   = ~MEM_VALID;
-            end
-            ReadData_M1: begin
-                MEM_RdData = (RVALID_M1 && RREADY_M1) ? RDATA_M1 : `AXI_DATA_BITS'd0;
-                MEM_DONE   = (RREADY_M1 && RLAST_M1 && RVALID_M1);
-            end
-            WriteResponse_M1: begin
-                MEM_DONE   = (BVALID_M1 && BREADY_M1);
-            end
-            default: begin
+        MEM_RdData    = `AXI_DATA_BITS'd0;
+        MEM_DONE      = 1'b0;
+        sb_push       = 1'b0;
+        sb_drain_done = (CurrentState_M1 == WriteResponse_M1) && WriteDrain_M1 && BVALID_M1 && BREADY_M1;
+
+        if (CurrentState_M1 != IDLE_M1) begin
+            if (~MEM_VALID) begin
+                MEM_DONE   = 1'b1;
+            end else if (mem_fence) begin
+                MEM_DONE   = sb_empty;
+            end else if (mem_store && ~mem_device) begin
+                sb_push    = 1'b1;
+                MEM_DONE   = sb_push_ready;
+            end else if (mem_load && ~mem_device && sb_ld_hit) begin
+                MEM_RdData = sb_ld_data;
+                MEM_DONE   = 1'b1;
+            end else begin
+                case (CurrentState_M1)
+                    ReadData_M1: begin
+                        MEM_RdData = (RVALID_M1 && RREADY_M1) ? RDATA_M1 : `AXI_DATA_BITS'd0;
+                        MEM_DONE   = (RREADY_M1 && RLAST_M1 && RVALID_M1);
+                    end
+                    WriteResponse_M1: begin
+                        MEM_DONE   = ~WriteDrain_M1 && BVALID_M1 && BREADY_M1;
+                    end
+                    default: begin
+                    end
+                endcase
             end
-        endcase
+        end
     end
 
+    // =============================================================================
+    // Store Buffer
+    // =============================================================================
+    Store_Buffer #(
+        .SB_ENTRIES     (4                ),
+        .LINE_WORDS     (4                ),
+        .DRAIN_AGE      (16               )
+    ) storeBuffer (
+        .clk            (clk              ),
+        .rst            (rst              ),
+
+        .push           (sb_push          ),
+        .push_addr      (MEM_ADDR         ),
+        .push_data      (MEM_WrData       ),
+        .push_strb      (MEM_STRB         ),
+        .push_ready     (sb_push_ready    ),
+
+        .ld_addr        (MEM_ADDR         ),
+        .ld_overlap     (sb_ld_overlap    ),
+        .ld_hit         (sb_ld_hit        ),
+        .ld_data        (sb_ld_data       ),
+
+        .drain_force    (sb_drain_force   ),
+        .drain_req      (sb_drain_req     ),
+        .drain_addr     (sb_drain_addr    ),
+        .drain_len      (sb_drain_len     ),
+        .drain_beat     (WBeat_M1         ),
+        .drain_wdata    (sb_drain_wdata   ),
+        .drain_wstrb    (sb_drain_wstrb   ),
+        .drain_done     (sb_drain_done    ),
+
+        .empty          (sb_empty         )
+    );
+
 //-----------------------------------------------------------CPU Instance-----------------------------------------------------------//
 
-CPU CPU (
+CPU #(
+    .HART_ID        (HART_ID         )
+) CPU (
     .clk            (clk             ),
     .rst            (rst             ),
     .DMA_interrupt  (DMA_interrupt   ),
 	.WTO_interrupt  (WTO_interrupt   ),
 
     .IF_RdData      (IF_RdData       ),
+    .IF_BEAT        (IF_BEAT         ),
     .IF_DONE        (IF_DONE         ),
     .MEM_RdData     (MEM_RdData      ),
     .MEM_DONE       (MEM_DONE        ),
 
     .IF_VALID       (IF_VALID        ),
     .IF_ADDR        (IF_ADDR         ),
+    .IF_LEN         (IF_LEN          ),
     .MEM_VALID      (MEM_VALID       ),
     .MEM_ADDR       (MEM_ADDR        ),
     .MEM_WrData     (MEM_WrData      ),
     .MEM_WEB        (MEM_WEB         ),
+    .MEM_FENCE      (MEM_FENCE       ),
     .MEM_STRB       (MEM_STRB        )
 );
 
@@ -1,6 +1,9 @@
 `include "../include/AXI_define.svh"
 
-module DRAM_wrapper (
+module DRAM_wrapper #(
+    parameter int SB_STREAMS = 2,   // tracked read streams (top: NUM_M)
+    parameter int SB_DEPTH   = 4    // read-ahead words per stream (power of 2)
+) (
 
     input   clk,
     input   rst,
@@ -64,7 +67,9 @@ module DRAM_wrapper (
         WriteColumn   = 3'd2,
         WriteResponse = 3'd3,
         RowHit        = 3'd4,
-        PreCharge     = 3'd5
+        PreCharge     = 3'd5,
+        StreamRead    = 3'd6,
+        Prefetch      = 3'd7
     } state_t;
 
     state_t CurrentState, NextState;
@@ -83,6 +88,54 @@ module DRAM_wrapper (
     logic [`AXI_DATA_BITS-1:0] buf_DRAM_Q;
     logic                      Rd, Wr, HitRow, MissRow;
 
+    //====================================================
+    // Stream Buffer
+    //----------------------------------------------------
+    // Each entry follows one read ID. The interconnect
+    // puts the master index in ID[7:4], so the IF, MEM and
+    // DMA streams stay apart although every master issues
+    // ID 0. st_next is the word (row, column) after the
+    // entry's last burst, and the buffer holds st_cnt
+    // words starting there. Two back-to-back bursts from
+    // the same ID arm the entry; while the wrapper idles
+    // in RowHit, an armed entry reads ahead with single
+    // CAS commands as long as the next word is in the open
+    // row. A later AR from that ID starting at st_next and
+    // covered by the buffer is answered from it at one
+    // beat per cycle without touching the DRAM.
+    // A read-ahead CAS holds ARREADY/AWREADY low until its
+    // word returns, so an entry only fills past its last
+    // burst length (st_len) while its last AR was a hit
+    // (st_hit); an entry nobody consumes stops there.
+    // Writes overlapping buffered words drop them.
+    //====================================================
+    localparam int SB_IDX_BITS = (SB_STREAMS > 1) ? $clog2(SB_STREAMS) : 1;
+    localparam int SB_PTR_BITS = (SB_DEPTH   > 1) ? $clog2(SB_DEPTH)   : 1;
+    localparam int SB_CNT_BITS = $clog2(SB_DEPTH + 1);
+
+    logic                      st_valid [SB_STREAMS];
+    logic                      st_armed [SB_STREAMS];
+    logic                      st_hit   [SB_STREAMS];
+    logic [`AXI_IDS_BITS-1:0 ] st_id    [SB_STREAMS];
+    logic [20:0]               st_next  [SB_STREAMS];   // ADDR[22:2]
+    logic [`AXI_LEN_BITS-1:0 ] st_len   [SB_STREAMS];
+    logic [SB_PTR_BITS-1:0]    st_head  [SB_STREAMS];
+    logic [SB_CNT_BITS-1:0]    st_cnt   [SB_STREAMS];
+    logic [`AXI_DATA_BITS-1:0] st_data  [SB_STREAMS][SB_DEPTH];
+    logic [SB_IDX_BITS-1:0]    st_victim;
+
+    logic [20:0]               ar_word, aw_lo, aw_hi;
+    logic                      ar_found, ar_seq, sb_hit;
+    logic [SB_IDX_BITS-1:0]    ar_s;
+
+    logic                      pf_any, pf_go;
+    logic [SB_IDX_BITS-1:0]    pf_s, pf_s_q;
+    logic [20:0]               pf_word;
+
+    logic [SB_IDX_BITS-1:0]    sr_s;
+    logic [SB_PTR_BITS-1:0]    sr_ptr;
+    logic [`AXI_DATA_BITS-1:0] sr_data;
+
     //====================================================
     // Finite State Machine
     //====================================================
@@ -118,16 +171,26 @@ module DRAM_wrapper (
                 else                               NextState = WriteResponse;
             end
             RowHit: begin
-                if      (ARVALID_S && HitRow)      NextState = ReadColumn;
+                if      (ARVALID_S && sb_hit)      NextState = StreamRead;
+                else if (ARVALID_S && HitRow)      NextState = ReadColumn;
                 else if (AWVALID_S && HitRow)      NextState = WriteColumn;
                 else if (ARVALID_S && ~HitRow)     NextState = PreCharge;
                 else if (AWVALID_S && ~HitRow)     NextState = PreCharge;
+                else if (pf_go)                    NextState = Prefetch;
                 else                               NextState = RowHit;
             end
             PreCharge: begin
                 if (DLY_cnt == 3'd4)               NextState = RowActivation;
                 else                               NextState = PreCharge;
             end
+            StreamRead: begin
+                if (RREADY_S & RVALID_S & RLAST_S) NextState = RowHit;
+                else                               NextState = StreamRead;
+            end
+            Prefetch: begin
+                if (DLY_cnt == 3'd5)               NextState = RowHit;
+                else                               NextState = Prefetch;
+            end
             default:                               NextState = RowActivation;
         endcase
     end
@@ -172,6 +235,13 @@ module DRAM_wrapper (
                 ARREADY_S = 1'b1;
                 AWREADY_S = 1'b1;
             end
+            StreamRead:begin
+                RID_S     = ARID;
+                RDATA_S   = sr_data;
+                RRESP_S   = `AXI_RESP_OKAY;
+                RLAST_S   = (LEN_cnt == LEN);
+                RVALID_S  = 1'b1;
+            end
             default:begin
             end
         endcase
@@ -190,7 +260,7 @@ module DRAM_wrapper (
             ARID <= (ARVALID_S) ? ARID_S  : ARID;
             AWID <= (AWVALID_S) ? AWID_S  : AWID;
             LEN  <= (ARVALID_S) ? ARLEN_S : (AWVALID_S ? AWLEN_S  : LEN);
-            ADDR <= (ARVALID_S) ? ARADDR_S: (AWVALID_S ? AWADDR_S : ADDR);
+            ADDR <= (ARVALID_S) ? (sb_hit ? ADDR : ARADDR_S) : (AWVALID_S ? AWADDR_S : ADDR);   // hit keeps the open row
         end
     end
 
@@ -220,7 +290,7 @@ module DRAM_wrapper (
     always_ff @(posedge clk or posedge rst) begin
         if (rst) MissRow <= 1'b0;
         else begin
-            if ((CurrentState == RowHit) && (ARVALID_S || AWVALID_S))
+            if ((CurrentState == RowHit) && (ARVALID_S || AWVALID_S) && ~sb_hit)
                 MissRow <= ~HitRow;
             else if (CurrentState == RowActivation)
                 MissRow <= 1'b0;
@@ -263,12 +333,17 @@ module DRAM_wrapper (
                     else                             DLY_cnt <= DLY_cnt + 3'd1;
                 end
                 RowHit: begin
-                    if(ARVALID_S)                    DLY_cnt <= DLY_cnt + 3'd1;
+                    if((ARVALID_S && ~sb_hit) || pf_go)
+                                                     DLY_cnt <= DLY_cnt + 3'd1;
                 end
                 PreCharge: begin
                     if (DLY_cnt == 3'd4)             DLY_cnt <= 3'd0;
                     else                             DLY_cnt <= DLY_cnt + 3'd1;
                 end
+                Prefetch: begin
+                    if (DLY_cnt == 3'd5)             DLY_cnt <= 3'd0; // read-ahead word is valid
+                    else                             DLY_cnt <= DLY_cnt + 3'd1;
+                end
                 default:                             DLY_cnt <= DLY_cnt;
             endcase
         end
@@ -281,7 +356,7 @@ module DRAM_wrapper (
         if(rst) begin
             buf_RVALID <= 1'b0;
             buf_DRAM_Q <= `AXI_DATA_BITS'b0;
-        end else if (RVALID_S && ~RREADY_S) begin   // Not immediate handshake
+        end else if ((CurrentState == ReadColumn) && RVALID_S && ~RREADY_S) begin   // Not immediate handshake
             buf_RVALID <= RVALID_S;
             buf_DRAM_Q <= DRAM_Q;
         end else if (buf_RVALID && RREADY_S) begin  // handshake->reset
@@ -290,6 +365,124 @@ module DRAM_wrapper (
         end
     end
 
+    // ============================================================
+	// Stream Lookup
+	// ============================================================
+    always_comb begin
+        ar_word  = ARADDR_S[22:2];
+        ar_found = 1'b0;
+        ar_s     = '0;
+        for (int i = 0; i < SB_STREAMS; i++) begin
+            if (st_valid[i] && (st_id[i] == ARID_S)) begin
+                ar_found = 1'b1;
+                ar_s     = SB_IDX_BITS'(i);
+            end
+        end
+        ar_seq = ar_found && (ar_word == st_next[ar_s]);
+        sb_hit = (CurrentState == RowHit) && ar_seq && (32'(st_cnt[ar_s]) > 32'(ARLEN_S));
+
+        aw_lo  = AWADDR_S[22:2];
+        aw_hi  = AWADDR_S[22:2] + 21'(AWLEN_S);
+    end
+
+    // ============================================================
+	// Read-Ahead Select
+	// ============================================================
+    always_comb begin
+        pf_any  = 1'b0;
+        pf_s    = '0;
+        pf_word = 21'd0;
+        for (int i = SB_STREAMS-1; i >= 0; i--) begin
+            if (st_valid[i] && st_armed[i] && (st_cnt[i] != SB_CNT_BITS'(SB_DEPTH))
+                && (st_hit[i] || (32'(st_cnt[i]) <= 32'(st_len[i])))                    // deeper only after a hit
+                && (((st_next[i] + 21'(st_cnt[i])) >> 10) == 21'(ADDR[22:12]))) begin   // stays in the open row
+                pf_any  = 1'b1;
+                pf_s    = SB_IDX_BITS'(i);
+                pf_word = st_next[i] + 21'(st_cnt[i]);
+            end
+        end
+        pf_go = (CurrentState == RowHit) && ~ARVALID_S && ~AWVALID_S && pf_any;
+    end
+
+    assign sr_data = st_data[sr_s][sr_ptr + SB_PTR_BITS'(LEN_cnt)];
+
+    // ============================================================
+	// Stream Update
+	// ============================================================
+    always_ff @(posedge clk or posedge rst) begin
+        if (rst) begin
+            for (int i = 0; i < SB_STREAMS; i++) begin
+                st_valid[i] <= 1'b0;
+                st_armed[i] <= 1'b0;
+                st_hit[i]   <= 1'b0;
+                st_id[i]    <= `AXI_IDS_BITS'd0;
+                st_next[i]  <= 21'd0;
+                st_len[i]   <= `AXI_LEN_BITS'd0;
+                st_head[i]  <= '0;
+                st_cnt[i]   <= '0;
+                for (int w = 0; w < SB_DEPTH; w++)
+                    st_data[i][w] <= `AXI_DATA_BITS'd0;
+            end
+            st_victim <= '0;
+            pf_s_q    <= '0;
+            sr_s      <= '0;
+            sr_ptr    <= '0;
+        end else begin
+            // ---------------------------------------
+            // AR accepted: track the ID, consume on hit
+            // ---------------------------------------
+            if (ARVALID_S && ARREADY_S) begin
+                if (ar_found) begin
+                    st_next[ar_s]  <= ar_word + 21'(ARLEN_S) + 21'd1;
+                    st_armed[ar_s] <= ar_seq;
+                    st_hit[ar_s]   <= sb_hit;
+                    st_len[ar_s]   <= ARLEN_S;
+                    if (sb_hit) begin
+                        st_head[ar_s] <= st_head[ar_s] + SB_PTR_BITS'(ARLEN_S) + SB_PTR_BITS'(1);
+                        st_cnt[ar_s]  <= st_cnt[ar_s]  - SB_CNT_BITS'(ARLEN_S) - SB_CNT_BITS'(1);
+                        sr_s          <= ar_s;
+                        sr_ptr        <= st_head[ar_s];
+                    end else begin
+                        st_head[ar_s] <= '0;
+                        st_cnt[ar_s]  <= '0;
+                    end
+                end else begin
+                    st_valid[st_victim] <= 1'b1;
+                    st_armed[st_victim] <= 1'b0;
+                    st_hit[st_victim]   <= 1'b0;
+                    st_id[st_victim]    <= ARID_S;
+                    st_next[st_victim]  <= ar_word + 21'(ARLEN_S) + 21'd1;
+                    st_len[st_victim]   <= ARLEN_S;
+                    st_head[st_victim]  <= '0;
+                    st_cnt[st_victim]   <= '0;
+                    st_victim           <= (st_victim == SB_IDX_BITS'(SB_STREAMS-1)) ? '0 : st_victim + SB_IDX_BITS'(1);
+                end
+            end
+
+            // ---------------------------------------
+            // Read-ahead word returned
+            // ---------------------------------------
+            if (pf_go)
+                pf_s_q <= pf_s;
+            if ((CurrentState == Prefetch) && (DLY_cnt == 3'd5)) begin
+                st_data[pf_s_q][st_head[pf_s_q] + SB_PTR_BITS'(st_cnt[pf_s_q])] <= DRAM_Q;
+                st_cnt[pf_s_q] <= st_cnt[pf_s_q] + SB_CNT_BITS'(1);
+            end
+
+            // ---------------------------------------
+            // AW accepted: drop overlapping buffers
+            // ---------------------------------------
+            if (AWVALID_S && AWREADY_S) begin
+                for (int i = 0; i < SB_STREAMS; i++) begin
+                    if ((st_cnt[i] != '0) && (aw_lo < st_next[i] + 21'(st_cnt[i])) && (aw_hi >= st_next[i])) begin
+                        st_head[i] <= '0;
+                        st_cnt[i]  <= '0;
+                    end
+                end
+            end
+        end
+    end
+
     // ============================================================
 	// DRAM Interface
 	// ============================================================
@@ -320,7 +513,14 @@ module DRAM_wrapper (
                 DRAM_D    = WDATA_S;
             end
             RowHit: begin
-                if ((ARVALID_S || AWVALID_S) && HitRow) begin
+                if (ARVALID_S && sb_hit) begin
+                    DRAM_CSn  = 1'b1;
+                    DRAM_RASn = 1'b1;
+                    DRAM_CASn = 1'b1;
+                    DRAM_WEn  = {`AXI_STRB_BITS{1'b1}};
+                    DRAM_A    = 11'd0;
+                    DRAM_D    = `AXI_DATA_BITS'd0;
+                end else if ((ARVALID_S || AWVALID_S) && HitRow) begin
                     DRAM_CSn  = 1'b0;
                     DRAM_RASn = 1'b1;
                     DRAM_CASn = ~ARVALID_S;
@@ -334,6 +534,13 @@ module DRAM_wrapper (
                     DRAM_WEn  = {`AXI_STRB_BITS{1'b0}};
                     DRAM_A    = ADDR[22:12];
                     DRAM_D    = `AXI_DATA_BITS'd0;
+                end else if (pf_go) begin
+                    DRAM_CSn  = 1'b0;
+                    DRAM_RASn = 1'b1;
+                    DRAM_CASn = 1'b0;
+                    DRAM_WEn  = {`AXI_STRB_BITS{1'b1}};
+                    DRAM_A    = {1'b0, pf_word[9:0]};
+                    DRAM_D    = `AXI_DATA_BITS'd0;
                 end else begin
                     DRAM_CSn  = 1'b1;
                     DRAM_RASn = 1'b1;
@@ -343,6 +550,14 @@ module DRAM_wrapper (
                     DRAM_D    = `AXI_DATA_BITS'd0;
                 end
                 end
+            Prefetch: begin
+                DRAM_CSn  = 1'b0;
+                DRAM_RASn = 1'b1;
+                DRAM_CASn = 1'b1;
+                DRAM_WEn  = {`AXI_STRB_BITS{1'b1}};
+                DRAM_A    = 11'd0;
+                DRAM_D    = `AXI_DATA_BITS'd0;
+            end
             default: begin
                 DRAM_CSn  = 1'b1;
                 DRAM_RASn = 1'b1;
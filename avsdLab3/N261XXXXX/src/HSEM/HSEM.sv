@@ -0,0 +1,89 @@
+module HSEM #(
+    parameter int NUM_LOCKS = 16,
+    parameter int NUM_MBOX  = 4
+) (
+    input  logic                      clk,
+    input  logic                      rst,
+
+    input  logic                      rd_en,    // read beat accepted
+    input  logic                      wr_en,    // write beat accepted
+    input  logic [9:0]                A,        // byte offset [11:2]
+    input  logic [`AXI_DATA_BITS-1:0] DI,
+    output logic [`AXI_DATA_BITS-1:0] DO
+);
+
+    // ============================================================
+    // Register Map (byte offset)
+    // ------------------------------------------------------------
+    //   0x000 + 4*i  LOCK[i]   read : returns the old value and sets
+    //                                 the lock (test-and-set); 0 means
+    //                                 the reader now owns it
+    //                          write: 0 releases
+    //   0x100 + 4*h  MBOX[h]   write: post a word (overwrites)
+    //                          read : pop (returns it, clears FULL)
+    //   0x200 + 4*h  MSTAT[h]  read : [0] FULL
+    // Side effects happen once per accepted beat, and beats are
+    // serialized by the interconnect, so harts never both win a lock.
+    // ============================================================
+    localparam logic [1:0] SEL_LOCK  = 2'd0;
+    localparam logic [1:0] SEL_MBOX  = 2'd1;
+    localparam logic [1:0] SEL_MSTAT = 2'd2;
+    localparam logic [1:0] SEL_NONE  = 2'd3;
+
+    // ============================================================
+    // Local Registers and Signals
+    // ============================================================
+    logic [NUM_LOCKS-1:0]      lock;
+    logic [`AXI_DATA_BITS-1:0] mbox [NUM_MBOX];
+    logic [NUM_MBOX-1:0]       full;
+
+    logic [1:0]                sel;
+    logic [5:0]                idx;
+
+    assign sel = (A[9:8] == 2'd0) ? A[7:6] : SEL_NONE;   // 0x000 / 0x100 / 0x200
+    assign idx = A[5:0];
+
+    // ============================================================
+    // Read Data (combinational)
+    // ============================================================
+    always_comb begin
+        DO = `AXI_DATA_BITS'd0;
+        case (sel)
+            SEL_LOCK:  if (idx < NUM_LOCKS) DO = {31'd0, lock[idx]};
+            SEL_MBOX:  if (idx < NUM_MBOX)  DO = mbox[idx];
+            SEL_MSTAT: if (idx < NUM_MBOX)  DO = {31'd0, full[idx]};
+            default: ;
+        endcase
+    end
+
+    // ============================================================
+    // Register Update
+    // ============================================================
+    always_ff @(posedge clk or posedge rst) begin
+        if (rst) begin
+            lock <= '0;
+            full <= '0;
+            for (int h = 0; h < NUM_MBOX; h++)
+                mbox[h] <= `AXI_DATA_BITS'd0;
+        end else begin
+            if (rd_en) begin
+                case (sel)
+                    SEL_LOCK: if (idx < NUM_LOCKS) lock[idx] <= 1'b1;
+                    SEL_MBOX: if (idx < NUM_MBOX)  full[idx] <= 1'b0;
+                    default: ;
+                endcase
+            end
+            if (wr_en) begin
+                case (sel)
+                    SEL_LOCK: if (idx < NUM_LOCKS) lock[idx] <= DI[0];
+                    SEL_MBOX: if (idx < NUM_MBOX) begin
+                        mbox[idx] <= DI;
+                        full[idx] <= 1'b1;
+                    end
+                    default: ;
+                endcase
+            end
+        end
+    end
+
+endmodule
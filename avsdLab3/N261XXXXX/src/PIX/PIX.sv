@@ -0,0 +1,364 @@
+`include "../src/PIX/PIX_FIFO.sv"
+
+module PIX #(
+    parameter int IN_DEPTH  = 16,   // input stream FIFO (words)
+    parameter int OUT_DEPTH = 64    // output stream FIFO (words)
+) (
+    input  logic                      clk,
+    input  logic                      rst,
+
+    // Register port
+    input  logic                      reg_we,
+    input  logic [2:0]                reg_a,
+    input  logic [`AXI_DATA_BITS-1:0] reg_di,
+    output logic [`AXI_DATA_BITS-1:0] reg_do,
+
+    // Input stream (packed 24-bit BGR pixels)
+    input  logic                      in_push,
+    input  logic [`AXI_DATA_BITS-1:0] in_data,
+    output logic                      in_full,
+
+    // Output stream (packed gray bytes)
+    input  logic                      out_pop,
+    output logic [`AXI_DATA_BITS-1:0] out_data,
+    output logic                      out_empty
+);
+
+    // ============================================================
+    // Register Map (word index)
+    // ------------------------------------------------------------
+    //   0 CTRL    [0] EN      0 clears FIFOs and stream state
+    //             [1] GRAY8   1 byte per pixel (else 3, BMP layout)
+    //             [2] WHITE   pure white input stays 0xFF
+    //             [3] THRESH  out = (gray >= THRESH) ? 0xFF : 0x00
+    //             [4] CLAMP   out = min(max(gray, LO), HI)
+    //   1 WEIGHT  {8'd0, R, G, B} channel weights
+    //   2 DIV     [15:0] divisor (exact for DIV < 16384)
+    //   3 THRESH  [7:0]
+    //   4 CLAMP   {16'd0, HI, LO}
+    //   5 STATUS  [0] DIV_BUSY [1] IDLE [15:8] IN count [23:16] OUT count
+    //   6 FLUSH   write: emit a partially packed output word
+    // ============================================================
+    localparam logic [2:0] REG_CTRL   = 3'd0;
+    localparam logic [2:0] REG_WEIGHT = 3'd1;
+    localparam logic [2:0] REG_DIV    = 3'd2;
+    localparam logic [2:0] REG_THRESH = 3'd3;
+    localparam logic [2:0] REG_CLAMP  = 3'd4;
+    localparam logic [2:0] REG_STATUS = 3'd5;
+    localparam logic [2:0] REG_FLUSH  = 3'd6;
+
+    // ============================================================
+    // Local Registers and Signals
+    // ============================================================
+    // Configuration
+    logic                      EN, GRAY8, WHITE, THRESH_EN, CLAMP_EN;
+    logic [7:0]                WB, WG, WR;
+    logic [15:0]               DIV;
+    logic [7:0]                THRESH, CLAMP_LO, CLAMP_HI;
+    logic                      clr;
+
+    // Reciprocal: ceil(2^32 / DIV), computed serially on a DIV write
+    logic [32:0]               recip;
+    logic [31:0]               div_quo;
+    logic [15:0]               div_rem;
+    logic [16:0]               div_rem_sh;
+    logic [5:0]                div_cnt;
+    logic                      div_busy;
+
+    // Stream FIFOs
+    logic                      in_pop, in_empty;
+    logic [`AXI_DATA_BITS-1:0] in_head;
+    logic [$clog2(IN_DEPTH):0] in_count;
+    logic                      out_push, out_full;
+    logic [`AXI_DATA_BITS-1:0] out_wdata;
+    logic [$clog2(OUT_DEPTH):0] out_count;
+
+    // Pipeline
+    logic                      adv;
+    logic [1:0]                phase;
+    logic [`AXI_DATA_BITS-1:0] prev;
+    logic                      need_head, pix_ok;
+    logic [7:0]                pix_b, pix_g, pix_r;
+
+    logic                      s1_v, s2_v, s3_v;
+    logic [7:0]                s1_b, s1_g, s1_r;
+    logic                      s1_white, s2_white, s3_white;
+    logic [17:0]               s2_sum;
+    logic [18:0]               s3_q;
+    logic [50:0]               s2_prod;
+    logic [7:0]                gray;
+
+    // Packer
+    logic [47:0]               pk_acc, pk_tmp;
+    logic [2:0]                pk_n, pk_nn;
+    logic                      pk_push;
+    logic                      flush_q, fl_push;
+    logic                      idle;
+
+    // ============================================================
+    // Register Write
+    // ============================================================
+    assign clr = reg_we && (reg_a == REG_CTRL) && ~reg_di[0];
+
+    always_ff @(posedge clk or posedge rst) begin
+        if (rst) begin
+            {CLAMP_EN, THRESH_EN, WHITE, GRAY8, EN} <= 5'd0;
+            WB       <= 8'd11;
+            WG       <= 8'd59;
+            WR       <= 8'd30;
+            DIV      <= 16'd100;
+            THRESH   <= 8'd128;
+            CLAMP_LO <= 8'd0;
+            CLAMP_HI <= 8'hFF;
+        end else if (reg_we) begin
+            case (reg_a)
+                REG_CTRL:   {CLAMP_EN, THRESH_EN, WHITE, GRAY8, EN} <= reg_di[4:0];
+                REG_WEIGHT: {WR, WG, WB}                            <= reg_di[23:0];
+                REG_DIV:    DIV                                     <= reg_di[15:0];
+                REG_THRESH: THRESH                                  <= reg_di[7:0];
+                REG_CLAMP:  {CLAMP_HI, CLAMP_LO}                    <= reg_di[15:0];
+                default: ;
+            endcase
+        end
+    end
+
+    // ============================================================
+    // Reciprocal Divider (restoring, one quotient bit per cycle)
+    // ------------------------------------------------------------
+    // q = (sum * ceil(2^32/D)) >> 32 equals sum / D whenever
+    // sum * D < 2^32; sum < 2^18 here, so D < 2^14 is exact.
+    // DIV = 0 behaves as DIV = 1.
+    // ============================================================
+    assign div_rem_sh = {div_rem, 1'b1};
+
+    always_ff @(posedge clk or posedge rst) begin
+        if (rst) begin
+            recip    <= 33'h0_028F_5C29;    // ceil(2^32 / 100)
+            div_quo  <= 32'd0;
+            div_rem  <= 16'd0;
+            div_cnt  <= 6'd0;
+            div_busy <= 1'b0;
+        end else if (reg_we && (reg_a == REG_DIV)) begin
+            div_quo  <= 32'd0;
+            div_rem  <= 16'd0;
+            div_cnt  <= 6'd32;
+            div_busy <= 1'b1;
+        end else if (div_busy) begin
+            if (div_rem_sh >= {1'b0, DIV}) begin
+                div_rem <= div_rem_sh[15:0] - DIV;
+                div_quo <= {div_quo[30:0], 1'b1};
+            end else begin
+                div_rem <= div_rem_sh[15:0];
+                div_quo <= {div_quo[30:0], 1'b0};
+            end
+            div_cnt <= div_cnt - 6'd1;
+            if (div_cnt == 6'd1) begin
+                div_busy <= 1'b0;
+                recip    <= {1'b0, div_quo[30:0], (div_rem_sh >= {1'b0, DIV})} + 33'd1;
+            end
+        end
+    end
+
+    // ============================================================
+    // Stream FIFOs
+    // ============================================================
+    PIX_FIFO #(
+        .DATA_WIDTH (`AXI_DATA_BITS ),
+        .DEPTH      (IN_DEPTH       )
+    ) inFIFO (
+        .clk        (clk            ),
+        .rst        (rst            ),
+        .clear      (clr            ),
+        .push       (in_push        ),
+        .wdata      (in_data        ),
+        .full       (in_full        ),
+        .pop        (in_pop         ),
+        .rdata      (in_head        ),
+        .empty      (in_empty       ),
+        .count      (in_count       )
+    );
+
+    PIX_FIFO #(
+        .DATA_WIDTH (`AXI_DATA_BITS ),
+        .DEPTH      (OUT_DEPTH      )
+    ) outFIFO (
+        .clk        (clk            ),
+        .rst        (rst            ),
+        .clear      (clr            ),
+        .push       (out_push       ),
+        .wdata      (out_wdata      ),
+        .full       (out_full       ),
+        .pop        (out_pop        ),
+        .rdata      (out_data       ),
+        .empty      (out_empty      ),
+        .count      (out_count      )
+    );
+
+    // ============================================================
+    // Pipeline Advance
+    // ------------------------------------------------------------
+    // The whole pipeline moves together; it stops while the output
+    // FIFO is full or the reciprocal is being recomputed.
+    // ============================================================
+    assign adv = EN && ~out_full && ~div_busy;
+
+    // ============================================================
+    // Stage 0: Unpack
+    // ------------------------------------------------------------
+    // Three words carry four BGR pixels:
+    //   W0 = {b1 r0 g0 b0}  W1 = {g2 b2 r1 g1}  W2 = {r3 g3 b3 r2}
+    // prev holds the last popped word, so one pixel leaves per cycle
+    // and phase 3 needs no new word.
+    // ============================================================
+    always_comb begin
+        case (phase)
+            2'd0: {pix_r, pix_g, pix_b} = {in_head[23:16], in_head[15: 8], in_head[ 7: 0]};
+            2'd1: {pix_r, pix_g, pix_b} = {in_head[15: 8], in_head[ 7: 0], prev[31:24]};
+            2'd2: {pix_r, pix_g, pix_b} = {in_head[ 7: 0], prev[31:24], prev[23:16]};
+            default: {pix_r, pix_g, pix_b} = {prev[31:24], prev[23:16], prev[15: 8]};
+        endcase
+        need_head = (phase != 2'd3);
+        pix_ok    = ~need_head || ~in_empty;
+        in_pop    = adv && pix_ok && need_head;
+    end
+
+    always_ff @(posedge clk or posedge rst) begin
+        if (rst) begin
+            phase    <= 2'd0;
+            prev     <= `AXI_DATA_BITS'd0;
+            s1_v     <= 1'b0;
+            s1_b     <= 8'd0;
+            s1_g     <= 8'd0;
+            s1_r     <= 8'd0;
+        end else if (clr) begin
+            phase    <= 2'd0;
+            s1_v     <= 1'b0;
+        end else if (adv) begin
+            s1_v     <= pix_ok;
+            s1_b     <= pix_b;
+            s1_g     <= pix_g;
+            s1_r     <= pix_r;
+            if (pix_ok) phase <= phase + 2'd1;
+            if (in_pop) prev  <= in_head;
+        end
+    end
+
+    // ============================================================
+    // Stage 1: Weighted Sum
+    // ============================================================
+    assign s1_white = (s1_b == 8'hFF) && (s1_g == 8'hFF) && (s1_r == 8'hFF);
+
+    always_ff @(posedge clk or posedge rst) begin
+        if (rst) begin
+            s2_v     <= 1'b0;
+            s2_sum   <= 18'd0;
+            s2_white <= 1'b0;
+        end else if (clr) begin
+            s2_v     <= 1'b0;
+        end else if (adv) begin
+            s2_v     <= s1_v;
+            s2_sum   <= s1_b * WB + s1_g * WG + s1_r * WR;
+            s2_white <= s1_white;
+        end
+    end
+
+    // ============================================================
+    // Stage 2: Divide (multiply by reciprocal)
+    // ============================================================
+    assign s2_prod = s2_sum * recip;
+
+    always_ff @(posedge clk or posedge rst) begin
+        if (rst) begin
+            s3_v     <= 1'b0;
+            s3_q     <= 19'd0;
+            s3_white <= 1'b0;
+        end else if (clr) begin
+            s3_v     <= 1'b0;
+        end else if (adv) begin
+            s3_v     <= s2_v;
+            s3_q     <= s2_prod[50:32];
+            s3_white <= s2_white;
+        end
+    end
+
+    // ============================================================
+    // Stage 3: Saturate / Clamp / Threshold
+    // ============================================================
+    always_comb begin
+        gray = (s3_q > 19'd255) ? 8'hFF : s3_q[7:0];
+        if (CLAMP_EN) begin
+            if      (gray < CLAMP_LO) gray = CLAMP_LO;
+            else if (gray > CLAMP_HI) gray = CLAMP_HI;
+        end
+        if (THRESH_EN)
+            gray = (gray >= THRESH) ? 8'hFF : 8'h00;
+        if (WHITE && s3_white)
+            gray = 8'hFF;
+    end
+
+    // ============================================================
+    // Output Packer
+    // ------------------------------------------------------------
+    // Bytes fill from the least significant end; a word is pushed
+    // once four are collected. BMP layout writes gray three times
+    // so four pixels again fill exactly three words.
+    // ============================================================
+    always_comb begin
+        pk_tmp  = pk_acc | ((GRAY8 ? {40'd0, gray} : {24'd0, gray, gray, gray}) << {pk_n, 3'b000});
+        pk_nn   = pk_n + (GRAY8 ? 3'd1 : 3'd3);
+        pk_push = adv && s3_v && (pk_nn >= 3'd4);
+
+        idle    = in_empty && (phase != 2'd3) && ~s1_v && ~s2_v && ~s3_v;
+        fl_push = flush_q && idle && ~out_full && (pk_n != 3'd0);
+
+        out_push  = pk_push || fl_push;
+        out_wdata = pk_push ? pk_tmp[31:0] : pk_acc[31:0];
+    end
+
+    always_ff @(posedge clk or posedge rst) begin
+        if (rst) begin
+            pk_acc  <= 48'd0;
+            pk_n    <= 3'd0;
+            flush_q <= 1'b0;
+        end else if (clr) begin
+            pk_acc  <= 48'd0;
+            pk_n    <= 3'd0;
+            flush_q <= 1'b0;
+        end else begin
+            if (adv && s3_v) begin
+                if (pk_push) begin
+                    pk_acc <= pk_tmp >> 32;
+                    pk_n   <= pk_nn - 3'd4;
+                end else begin
+                    pk_acc <= pk_tmp;
+                    pk_n   <= pk_nn;
+                end
+            end else if (fl_push) begin
+                pk_acc <= 48'd0;
+                pk_n   <= 3'd0;
+            end
+
+            if (reg_we && (reg_a == REG_FLUSH))
+                flush_q <= 1'b1;
+            else if (idle && (fl_push || (pk_n == 3'd0)))
+                flush_q <= 1'b0;
+        end
+    end
+
+    // ============================================================
+    // Register Read (combinational)
+    // ============================================================
+    always_comb begin
+        case (reg_a)
+            REG_CTRL:   reg_do = {27'd0, CLAMP_EN, THRESH_EN, WHITE, GRAY8, EN};
+            REG_WEIGHT: reg_do = {8'd0, WR, WG, WB};
+            REG_DIV:    reg_do = {16'd0, DIV};
+            REG_THRESH: reg_do = {24'd0, THRESH};
+            REG_CLAMP:  reg_do = {16'd0, CLAMP_HI, CLAMP_LO};
+            REG_STATUS: reg_do = {8'd0, 8'(out_count), 8'(in_count),
+                                  6'd0, (idle && (pk_n == 3'd0)), div_busy};
+            default:    reg_do = `AXI_DATA_BITS'd0;
+        endcase
+    end
+
+endmodule
@@ -0,0 +1,58 @@
+module PIX_FIFO #(
+    parameter int DATA_WIDTH = 32,
+    parameter int DEPTH      = 16   // power of 2
+) (
+    input  logic                  clk,
+    input  logic                  rst,
+    input  logic                  clear,    // drop all entries
+
+    input  logic                  push,
+    input  logic [DATA_WIDTH-1:0] wdata,
+    output logic                  full,
+
+    input  logic                  pop,
+    output logic [DATA_WIDTH-1:0] rdata,    // head, valid when !empty
+    output logic                  empty,
+
+    output logic [$clog2(DEPTH):0] count
+);
+
+    // ============================================================
+    // Local Parameters
+    // ============================================================
+    localparam int ADDR_WIDTH = $clog2(DEPTH);
+
+    // ============================================================
+    // Storage and Pointers
+    // ============================================================
+    logic [DATA_WIDTH-1:0] fifo_memory [DEPTH-1:0];
+    logic [ADDR_WIDTH:0]   wptr, rptr;
+    logic                  do_push, do_pop;
+
+    assign do_push = push && ~full;
+    assign do_pop  = pop  && ~empty;
+
+    assign count   = wptr - rptr;
+    assign full    = (count == (ADDR_WIDTH+1)'(DEPTH));
+    assign empty   = (wptr == rptr);
+    assign rdata   = fifo_memory[rptr[ADDR_WIDTH-1:0]];
+
+    always_ff @(posedge clk or posedge rst) begin
+        if (rst) begin
+            wptr <= '0;
+            rptr <= '0;
+        end else if (clear) begin
+            wptr <= '0;
+            rptr <= '0;
+        end else begin
+            if (do_push) wptr <= wptr + 1'b1;
+            if (do_pop)  rptr <= rptr + 1'b1;
+        end
+    end
+
+    always_ff @(posedge clk) begin
+        if (do_push)
+            fifo_memory[wptr[ADDR_WIDTH-1:0]] <= wdata;
+    end
+
+endmodule
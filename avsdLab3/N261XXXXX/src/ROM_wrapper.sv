@@ -67,6 +67,8 @@ module ROM_wrapper (
 	// Local Signals
 	// ============================================================
 	logic [`AXI_IDS_BITS-1:0] 	AWID, ARID;
+	logic [`AXI_ADDR_BITS-1:0]  ADDR;
+	logic [`AXI_LEN_BITS-1:0]   LEN, LEN_cnt;
 	logic [`AXI_DATA_BITS-1:0]  Buffer;
 	logic 						Buffer_valid;
 
@@ -93,7 +95,8 @@ module ROM_wrapper (
             else                NextState = ACCEPT;
         end
         ReadData: begin
-            if (RREADY_S)       NextState = ACCEPT;
+            if (RREADY_S && RLAST_S)
+                                NextState = ACCEPT;
             else                NextState = CurrentState;
         end
         WriteData: begin
@@ -134,7 +137,7 @@ module ROM_wrapper (
                 RDATA_S   = (Buffer_valid) ? Buffer : ROM_out;
                 RRESP_S   = `AXI_RESP_OKAY;
                 RVALID_S  = 1'b1;
-                RLAST_S   = 1'b1;
+                RLAST_S   = (LEN_cnt == LEN);
             end
             WriteData: begin
                 WREADY_S  = 1'b1;
@@ -148,19 +151,33 @@ module ROM_wrapper (
     end
 
 	// ============================================================
-	// ID Storage
+	// ID / Burst Storage
 	// ============================================================
 	always_ff @(posedge clk or posedge rst) begin
         if (rst) begin
             ARID  <= `AXI_IDS_BITS'd0;
             AWID  <= `AXI_IDS_BITS'd0;
+            ADDR  <= `AXI_ADDR_BITS'd0;
+            LEN   <= `AXI_LEN_BITS'd0;
         end
         else if (CurrentState == ACCEPT) begin
             ARID  <= ARVALID_S ? ARID_S : ARID;
             AWID  <= AWVALID_S ? AWID_S : AWID;
+            ADDR  <= ARVALID_S ? ARADDR_S : ADDR;
+            LEN   <= ARVALID_S ? ARLEN_S  : LEN;
         end
     end
 
+	// ============================================================
+	// Read Beat Counter
+	// ============================================================
+	always_ff @(posedge clk or posedge rst) begin
+		if (rst)
+			LEN_cnt <= `AXI_LEN_BITS'd0;
+		else if (RVALID_S && RREADY_S)
+			LEN_cnt <= RLAST_S ? `AXI_LEN_BITS'd0 : LEN_cnt + `AXI_LEN_BITS'd1;
+	end
+
     // ============================================================
 	// Read Data Buffer
 	// ============================================================
@@ -189,10 +206,11 @@ module ROM_wrapper (
                 ROM_read    = 1'b0;
                 ROM_address = ARVALID_S ? ARADDR_S[13:2] : 12'd0;
             end
+            // Next beat of a burst is read as the current one is taken
             ReadData : begin
-                ROM_enable  = 1'b0;
+                ROM_enable  = RREADY_S && ~RLAST_S;
                 ROM_read    = 1'b1;
-                ROM_address = 12'd0;
+                ROM_address = ADDR[13:2] + {8'd0, LEN_cnt + `AXI_LEN_BITS'd1};
             end
             default : begin
                 ROM_enable  = 1'b0;
@@ -5,6 +5,11 @@
 `include "../src/DRAM_wrapper.sv"
 `include "../src/DMA_wrapper.sv"
 `include "../src/WDT_wrapper.sv"
+`include "../src/PIX_wrapper.sv"
+`include "../src/HSEM_wrapper.sv"
+`ifdef DRAM_ASYNC
+`include "../src/CDC_lib/AXI_CDC_Bridge.sv"
+`endif
 `include "../src/AXI/AXI.sv"
 
 module top(
@@ -13,6 +18,10 @@ module top(
 	input							rst,
 	input							clk2,
 	input							rst2,
+`ifdef DRAM_ASYNC
+	input							clk3,	// DRAM domain clock
+	input							rst3,
+`endif
 
     // ROM Interface
 	output							ROM_enable,
@@ -35,10 +44,17 @@ module top(
 	// ============================================================
 	// Local Parameters
 	// ============================================================
+`ifdef DUAL_CORE
+	localparam int NUM_M     = 5;	// hart 1 adds M3 (IM) and M4 (DM)
+    localparam int NUM_S     = 8;
+    localparam int MIDX_BITS = 4;
+    localparam int SIDX_BITS = 3;
+`else
 	localparam int NUM_M     = 3;
-    localparam int NUM_S     = 6;
-    localparam int MIDX_BITS = 3;
+    localparam int NUM_S     = 8;
+    localparam int MIDX_BITS = 4;
     localparam int SIDX_BITS = 2;
+`endif
 
 	// ============================================================
 	// Interrupt Signals
@@ -117,6 +133,38 @@ module top(
     logic [NUM_S-1:0]                     BVALID_S;
     logic [NUM_S-1:0]                     BREADY_S;
 
+	// ============================================================
+	// DRAM Side AXI Signals (after optional clock-domain bridge)
+	// ============================================================
+	logic                                 DRAM_clk, DRAM_rst;
+
+	logic [`AXI_IDS_BITS-1:0]             ARID_D;
+    logic [`AXI_ADDR_BITS-1:0]            ARADDR_D;
+    logic [`AXI_LEN_BITS-1:0]             ARLEN_D;
+    logic [`AXI_SIZE_BITS-1:0]            ARSIZE_D;
+    logic [1:0]                           ARBURST_D;
+    logic                                 ARVALID_D, ARREADY_D;
+
+    logic [`AXI_IDS_BITS-1:0]             RID_D;
+    logic [`AXI_DATA_BITS-1:0]            RDATA_D;
+    logic [1:0]                           RRESP_D;
+    logic                                 RLAST_D, RVALID_D, RREADY_D;
+
+    logic [`AXI_IDS_BITS-1:0]             AWID_D;
+    logic [`AXI_ADDR_BITS-1:0]            AWADDR_D;
+    logic [`AXI_LEN_BITS-1:0]             AWLEN_D;
+    logic [`AXI_SIZE_BITS-1:0]            AWSIZE_D;
+    logic [1:0]                           AWBURST_D;
+    logic                                 AWVALID_D, AWREADY_D;
+
+    logic [`AXI_DATA_BITS-1:0]            WDATA_D;
+    logic [`AXI_STRB_BITS-1:0]            WSTRB_D;
+    logic                                 WLAST_D, WVALID_D, WREADY_D;
+
+    logic [`AXI_IDS_BITS-1:0]             BID_D;
+    logic [1:0]                           BRESP_D;
+    logic                                 BVALID_D, BREADY_D;
+
 	// ============================================================
 	// Master 0 Write Channel Default Assignment
 	// ============================================================
@@ -134,6 +182,25 @@ module top(
 
 	assign BREADY_M[0]  = 1'b0;
 
+`ifdef DUAL_CORE
+	// ============================================================
+	// Master 3 Write Channel Default Assignment
+	// ============================================================
+	assign AWID_M[3]    = `AXI_ID_BITS'd0;
+	assign AWADDR_M[3]  = `AXI_ADDR_BITS'd0;
+	assign AWLEN_M[3]   = `AXI_LEN_BITS'd0;
+	assign AWSIZE_M[3]  = `AXI_SIZE_BITS'd0;
+	assign AWBURST_M[3] = 2'd0;
+	assign AWVALID_M[3] = 1'b0;
+
+	assign WDATA_M[3]   = `AXI_DATA_BITS'd0;
+	assign WSTRB_M[3]   = `AXI_STRB_BITS'd0;
+	assign WLAST_M[3]   = 1'b0;
+	assign WVALID_M[3]  = 1'b0;
+
+	assign BREADY_M[3]  = 1'b0;
+`endif
+
 	// ============================================================
 	// Module Instance
 	// ============================================================
@@ -197,6 +264,70 @@ module top(
 		.BREADY_M1      (BREADY_M[1]       )
 	);
 
+`ifdef DUAL_CORE
+	CPU_wrapper #(
+		.HART_ID        (1                  )
+	) CPU_wrapper1(
+		.clk            (clk                ),
+		.rst            (rst                ),
+
+		// interrupts are routed to hart 0 only
+		.DMA_interrupt  (1'b0              ),
+		.WTO_interrupt  (1'b0              ),
+
+        // Master 3
+		.ARID_M0        (ARID_M[3]         ),
+		.ARADDR_M0      (ARADDR_M[3]       ),
+		.ARLEN_M0       (ARLEN_M[3]        ),
+		.ARSIZE_M0      (ARSIZE_M[3]       ),
+		.ARBURST_M0     (ARBURST_M[3]      ),
+		.ARVALID_M0     (ARVALID_M[3]      ),
+		.ARREADY_M0     (ARREADY_M[3]      ),
+
+		.RID_M0         (RID_M[3]          ),
+		.RDATA_M0       (RDATA_M[3]        ),
+		.RRESP_M0       (RRESP_M[3]        ),
+		.RLAST_M0       (RLAST_M[3]        ),
+		.RVALID_M0      (RVALID_M[3]       ),
+		.RREADY_M0      (RREADY_M[3]       ),
+
+        // Master 4
+		.ARID_M1        (ARID_M[4]         ),
+		.ARADDR_M1      (ARADDR_M[4]       ),
+		.ARLEN_M1       (ARLEN_M[4]        ),
+		.ARSIZE_M1      (ARSIZE_M[4]       ),
+		.ARBURST_M1     (ARBURST_M[4]      ),
+		.ARVALID_M1     (ARVALID_M[4]      ),
+		.ARREADY_M1     (ARREADY_M[4]      ),
+
+		.RID_M1         (RID_M[4]          ),
+		.RDATA_M1       (RDATA_M[4]        ),
+		.RRESP_M1       (RRESP_M[4]        ),
+		.RLAST_M1       (RLAST_M[4]        ),
+		.RVALID_M1      (RVALID_M[4]       ),
+		.RREADY_M1      (RREADY_M[4]       ),
+
+		.AWID_M1        (AWID_M[4]         ),
+		.AWADDR_M1      (AWADDR_M[4]       ),
+		.AWLEN_M1       (AWLEN_M[4]        ),
+		.AWSIZE_M1      (AWSIZE_M[4]       ),
+		.AWBURST_M1     (AWBURST_M[4]      ),
+		.AWVALID_M1     (AWVALID_M[4]      ),
+		.AWREADY_M1     (AWREADY_M[4]      ),
+
+		.WDATA_M1       (WDATA_M[4]        ),
+		.WSTRB_M1       (WSTRB_M[4]        ),
+		.WLAST_M1       (WLAST_M[4]        ),
+		.WVALID_M1      (WVALID_M[4]       ),
+		.WREADY_M1      (WREADY_M[4]       ),
+
+		.BID_M1         (BID_M[4]          ),
+		.BRESP_M1       (BRESP_M[4]        ),
+		.BVALID_M1      (BVALID_M[4]       ),
+		.BREADY_M1      (BREADY_M[4]       )
+	);
+`endif
+
 	ROM_wrapper ROM_wrapper(
 		.clk			(clk				),
 		.rst			(rst     			),
@@ -440,9 +571,97 @@ module top(
 		.WTO_interrupt (WTO_interrupt   )
 	);
 
-	DRAM_wrapper DRAM_wrapper(
-		.clk         (clk           ),
-		.rst         (rst           ),
+	PIX_wrapper PIX_wrapper(
+		.clk			(clk				),
+		.rst			(rst     			),
+
+		.ARID_S			(ARID_S[6]			),
+		.ARADDR_S		(ARADDR_S[6]		),
+		.ARLEN_S		(ARLEN_S[6]			),
+		.ARSIZE_S		(ARSIZE_S[6]		),
+		.ARBURST_S		(ARBURST_S[6]		),
+		.ARVALID_S		(ARVALID_S[6]		),
+		.ARREADY_S		(ARREADY_S[6]		),
+
+		.RID_S			(RID_S[6]			),
+		.RDATA_S		(RDATA_S[6]			),
+		.RRESP_S		(RRESP_S[6]			),
+		.RLAST_S		(RLAST_S[6]			),
+		.RVALID_S		(RVALID_S[6]		),
+		.RREADY_S		(RREADY_S[6]		),
+
+		.AWID_S			(AWID_S[6]			),
+		.AWADDR_S		(AWADDR_S[6]		),
+		.AWLEN_S		(AWLEN_S[6]			),
+		.AWSIZE_S		(AWSIZE_S[6]		),
+		.AWBURST_S		(AWBURST_S[6]		),
+		.AWVALID_S		(AWVALID_S[6]		),
+		.AWREADY_S		(AWREADY_S[6]		),
+
+		.WDATA_S		(WDATA_S[6]			),
+		.WSTRB_S		(WSTRB_S[6]			),
+		.WLAST_S		(WLAST_S[6]			),
+		.WVALID_S		(WVALID_S[6]		),
+		.WREADY_S		(WREADY_S[6]		),
+
+		.BID_S			(BID_S[6]			),
+		.BRESP_S		(BRESP_S[6]			),
+		.BVALID_S		(BVALID_S[6]		),
+		.BREADY_S		(BREADY_S[6]		)
+	);
+
+	HSEM_wrapper HSEM_wrapper(
+		.clk			(clk				),
+		.rst			(rst     			),
+
+		.ARID_S			(ARID_S[7]			),
+		.ARADDR_S		(ARADDR_S[7]		),
+		.ARLEN_S		(ARLEN_S[7]			),
+		.ARSIZE_S		(ARSIZE_S[7]		),
+		.ARBURST_S		(ARBURST_S[7]		),
+		.ARVALID_S		(ARVALID_S[7]		),
+		.ARREADY_S		(ARREADY_S[7]		),
+
+		.RID_S			(RID_S[7]			),
+		.RDATA_S		(RDATA_S[7]			),
+		.RRESP_S		(RRESP_S[7]			),
+		.RLAST_S		(RLAST_S[7]			),
+		.RVALID_S		(RVALID_S[7]		),
+		.RREADY_S		(RREADY_S[7]		),
+
+		.AWID_S			(AWID_S[7]			),
+		.AWADDR_S		(AWADDR_S[7]		),
+		.AWLEN_S		(AWLEN_S[7]			),
+		.AWSIZE_S		(AWSIZE_S[7]		),
+		.AWBURST_S		(AWBURST_S[7]		),
+		.AWVALID_S		(AWVALID_S[7]		),
+		.AWREADY_S		(AWREADY_S[7]		),
+
+		.WDATA_S		(WDATA_S[7]			),
+		.WSTRB_S		(WSTRB_S[7]			),
+		.WLAST_S		(WLAST_S[7]			),
+		.WVALID_S		(WVALID_S[7]		),
+		.WREADY_S		(WREADY_S[7]		),
+
+		.BID_S			(BID_S[7]			),
+		.BRESP_S		(BRESP_S[7]			),
+		.BVALID_S		(BVALID_S[7]		),
+		.BREADY_S		(BREADY_S[7]		)
+	);
+
+`ifdef DRAM_ASYNC
+	// ============================================================
+	// DRAM on its own clock (clk3) behind an AXI async bridge
+	// ============================================================
+	assign DRAM_clk = clk3;
+	assign DRAM_rst = rst3;
+
+	AXI_CDC_Bridge #(
+		.ADDR_DEPTH  (4             ),
+		.DATA_DEPTH  (16            )
+	) DRAM_bridge (
+		.s_clk       (clk           ),
+		.s_rst       (rst           ),
 
 		.ARID_S      (ARID_S[5]     ),
 		.ARADDR_S    (ARADDR_S[5]   ),
@@ -478,6 +697,125 @@ module top(
 		.BVALID_S    (BVALID_S[5]   ),
 		.BREADY_S    (BREADY_S[5]   ),
 
+		.m_clk       (clk3          ),
+		.m_rst       (rst3          ),
+
+		.ARID_M      (ARID_D        ),
+		.ARADDR_M    (ARADDR_D      ),
+		.ARLEN_M     (ARLEN_D       ),
+		.ARSIZE_M    (ARSIZE_D      ),
+		.ARBURST_M   (ARBURST_D     ),
+		.ARVALID_M   (ARVALID_D     ),
+		.ARREADY_M   (ARREADY_D     ),
+
+		.RID_M       (RID_D         ),
+		.RDATA_M     (RDATA_D       ),
+		.RRESP_M     (RRESP_D       ),
+		.RLAST_M     (RLAST_D       ),
+		.RVALID_M    (RVALID_D      ),
+		.RREADY_M    (RREADY_D      ),
+
+		.AWID_M      (AWID_D        ),
+		.AWADDR_M    (AWADDR_D      ),
+		.AWLEN_M     (AWLEN_D       ),
+		.AWSIZE_M    (AWSIZE_D      ),
+		.AWBURST_M   (AWBURST_D     ),
+		.AWVALID_M   (AWVALID_D     ),
+		.AWREADY_M   (AWREADY_D     ),
+
+		.WDATA_M     (WDATA_D       ),
+		.WSTRB_M     (WSTRB_D       ),
+		.WLAST_M     (WLAST_D       ),
+		.WVALID_M    (WVALID_D      ),
+		.WREADY_M    (WREADY_D      ),
+
+		.BID_M       (BID_D         ),
+		.BRESP_M     (BRESP_D       ),
+		.BVALID_M    (BVALID_D      ),
+		.BREADY_M    (BREADY_D      )
+	);
+`else
+	// ============================================================
+	// DRAM on the core clock, wired straight to slave port 5
+	// ============================================================
+	assign DRAM_clk     = clk;
+	assign DRAM_rst     = rst;
+
+	assign ARID_D       = ARID_S[5];
+	assign ARADDR_D     = ARADDR_S[5];
+	assign ARLEN_D      = ARLEN_S[5];
+	assign ARSIZE_D     = ARSIZE_S[5];
+	assign ARBURST_D    = ARBURST_S[5];
+	assign ARVALID_D    = ARVALID_S[5];
+	assign ARREADY_S[5] = ARREADY_D;
+
+	assign RID_S[5]     = RID_D;
+	assign RDATA_S[5]   = RDATA_D;
+	assign RRESP_S[5]   = RRESP_D;
+	assign RLAST_S[5]   = RLAST_D;
+	assign RVALID_S[5]  = RVALID_D;
+	assign RREADY_D     = RREADY_S[5];
+
+	assign AWID_D       = AWID_S[5];
+	assign AWADDR_D     = AWADDR_S[5];
+	assign AWLEN_D      = AWLEN_S[5];
+	assign AWSIZE_D     = AWSIZE_S[5];
+	assign AWBURST_D    = AWBURST_S[5];
+	assign AWVALID_D    = AWVALID_S[5];
+	assign AWREADY_S[5] = AWREADY_D;
+
+	assign WDATA_D      = WDATA_S[5];
+	assign WSTRB_D      = WSTRB_S[5];
+	assign WLAST_D      = WLAST_S[5];
+	assign WVALID_D     = WVALID_S[5];
+	assign WREADY_S[5]  = WREADY_D;
+
+	assign BID_S[5]     = BID_D;
+	assign BRESP_S[5]   = BRESP_D;
+	assign BVALID_S[5]  = BVALID_D;
+	assign BREADY_D     = BREADY_S[5];
+`endif
+
+	DRAM_wrapper #(
+		.SB_STREAMS  (NUM_M         )
+	) DRAM_wrapper(
+		.clk         (DRAM_clk      ),
+		.rst         (DRAM_rst      ),
+
+		.ARID_S      (ARID_D        ),
+		.ARADDR_S    (ARADDR_D      ),
+		.ARLEN_S     (ARLEN_D       ),
+		.ARSIZE_S    (ARSIZE_D      ),
+		.ARBURST_S   (ARBURST_D     ),
+		.ARVALID_S   (ARVALID_D     ),
+		.ARREADY_S   (ARREADY_D     ),
+
+		.RID_S       (RID_D         ),
+		.RDATA_S     (RDATA_D       ),
+		.RRESP_S     (RRESP_D       ),
+		.RLAST_S     (RLAST_D       ),
+		.RVALID_S    (RVALID_D      ),
+		.RREADY_S    (RREADY_D      ),
+
+		.AWID_S      (AWID_D        ),
+		.AWADDR_S    (AWADDR_D      ),
+		.AWLEN_S     (AWLEN_D       ),
+		.AWSIZE_S    (AWSIZE_D      ),
+		.AWBURST_S   (AWBURST_D     ),
+		.AWVALID_S   (AWVALID_D     ),
+		.AWREADY_S   (AWREADY_D     ),
+
+		.WDATA_S     (WDATA_D       ),
+		.WSTRB_S     (WSTRB_D       ),
+		.WLAST_S     (WLAST_D       ),
+		.WVALID_S    (WVALID_D      ),
+		.WREADY_S    (WREADY_D      ),
+
+		.BID_S       (BID_D         ),
+		.BRESP_S     (BRESP_D       ),
+		.BVALID_S    (BVALID_D      ),
+		.BREADY_S    (BREADY_D      ),
+
 		.DRAM_CSn    (DRAM_CSn      ),
 		.DRAM_WEn    (DRAM_WEn      ),
 		.DRAM_RASn   (DRAM_RASn     ),